@@ -178,6 +178,8 @@ template <MethodNameType MethodName, typename... Paras> class TA_MetaActivity {
 
     void setParas(Paras &&...paras) { m_paras = std::make_tuple(std::forward<Paras>(paras)...); }
 
+    const auto &paras() const { return m_paras; }
+
   private:
     template <typename T>
     using StorageType = std::conditional_t <
@@ -252,6 +254,10 @@ template <typename Method, typename... Args> class TA_MethodActivity {
         }
     }
 
+    const auto &method() const { return m_method; }
+
+    const auto &args() const { return m_args; }
+
   private:
     decltype(auto) run() { return std::apply(m_method, m_args); }
 
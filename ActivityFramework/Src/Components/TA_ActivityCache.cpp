@@ -0,0 +1,77 @@
+/*
+ * Copyright [2025] [Shuang Zhu / Sol]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Components/TA_ActivityCache.h"
+
+#include <algorithm>
+
+namespace CoreAsync {
+TA_ActivityCache::TA_ActivityCache(std::size_t capacity, std::chrono::milliseconds ttl, std::size_t shardSize)
+    : m_capacity(std::max<std::size_t>(capacity, 1)),
+      m_shardCapacity(std::max<std::size_t>(m_capacity / std::clamp<std::size_t>(shardSize, 1, m_capacity), 1)),
+      m_ttl(ttl), m_shards(std::clamp<std::size_t>(shardSize, 1, m_capacity)) {}
+
+std::shared_ptr<TA_ActivityProxy> TA_ActivityCache::acquire(Key &&key, const std::shared_ptr<TA_ActivityProxy> &pProxy,
+                                                            const std::shared_ptr<Expiry> &pExpiry) {
+    auto &shard{m_shards[(key.hash ^ (key.hash >> 32)) % m_shards.size()]};
+    const auto now{std::chrono::steady_clock::now()};
+    std::lock_guard<std::mutex> locker(shard.mutex);
+    auto iter{shard.index.find(key)};
+    if (iter != shard.index.end()) {
+        auto entryIter{iter->second};
+        const bool ready{entryIter->pProxy->isReady()};
+        if (!ready || m_ttl == std::chrono::milliseconds::zero() || now < entryIter->pExpiry->load(std::memory_order_acquire)) {
+            shard.entries.splice(shard.entries.begin(), shard.entries, entryIter);
+            (ready ? m_hits : m_coalesced).fetch_add(1, std::memory_order_relaxed);
+            return entryIter->pProxy;
+        }
+        shard.index.erase(iter);
+        shard.entries.erase(entryIter);
+        m_evictions.fetch_add(1, std::memory_order_relaxed);
+    }
+    m_misses.fetch_add(1, std::memory_order_relaxed);
+    shard.entries.emplace_front(Entry{key, pProxy, pExpiry});
+    shard.index.emplace(std::move(key), shard.entries.begin());
+    while (shard.entries.size() > m_shardCapacity) {
+        shard.index.erase(shard.entries.back().key);
+        shard.entries.pop_back();
+        m_evictions.fetch_add(1, std::memory_order_relaxed);
+    }
+    return pProxy;
+}
+
+void TA_ActivityCache::clear() {
+    for (auto &shard : m_shards) {
+        std::lock_guard<std::mutex> locker(shard.mutex);
+        shard.index.clear();
+        shard.entries.clear();
+    }
+}
+
+std::size_t TA_ActivityCache::size() const {
+    std::size_t count{0};
+    for (const auto &shard : m_shards) {
+        std::lock_guard<std::mutex> locker(shard.mutex);
+        count += shard.entries.size();
+    }
+    return count;
+}
+
+TA_ActivityCache::Statistics TA_ActivityCache::statistics() const {
+    return {m_hits.load(std::memory_order_relaxed), m_coalesced.load(std::memory_order_relaxed),
+            m_misses.load(std::memory_order_relaxed), m_evictions.load(std::memory_order_relaxed)};
+}
+} // namespace CoreAsync
@@ -0,0 +1,196 @@
+/*
+ * Copyright [2025] [Shuang Zhu / Sol]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TA_ACTIVITYCACHE_H
+#define TA_ACTIVITYCACHE_H
+
+#include "TA_Activity.h"
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+namespace CoreAsync {
+template <typename T>
+concept MemoizableValue =
+    std::is_empty_v<T> || std::is_member_pointer_v<T> || requires(const T &lhs, const T &rhs) {
+        { std::hash<T>{}(lhs) } -> std::convertible_to<std::size_t>;
+        { lhs == rhs } -> std::convertible_to<bool>;
+    };
+
+/*
+ * Memoizing front end of TA_ThreadPool::postActivity for activities that are pure functions of their arguments.
+ *
+ * An activity is identified by its type, its callable and its stored arguments, so posting an equal activity again
+ * returns a fetcher on the result of the first one instead of running it. The entry is created before the activity
+ * runs, which coalesces concurrent identical posts into a single execution whose result every fetcher shares. The
+ * cache is split into independently locked LRU shards, and entries are dropped when a shard is full or, with a
+ * non-zero ttl, once the result is older than ttl.
+ */
+class ACTIVITY_FRAMEWORK_EXPORT TA_ActivityCache {
+  public:
+    struct Statistics {
+        std::size_t hits{0};
+        std::size_t coalesced{0};
+        std::size_t misses{0};
+        std::size_t evictions{0};
+    };
+
+    explicit TA_ActivityCache(std::size_t capacity = 1024,
+                              std::chrono::milliseconds ttl = std::chrono::milliseconds::zero(),
+                              std::size_t shardSize = 16);
+
+    TA_ActivityCache(const TA_ActivityCache &cache) = delete;
+    TA_ActivityCache(TA_ActivityCache &&cache) = delete;
+    TA_ActivityCache &operator=(const TA_ActivityCache &cache) = delete;
+
+    template <ActivityType Activity>
+    [[nodiscard]] auto postActivity(Activity *pActivity, bool autoDelete = false,
+                                    TA_ThreadPool &pool = TA_ThreadHolder::get()) -> TA_ActivityResultFetcher {
+        if (!pActivity)
+            throw std::invalid_argument("Activity is null");
+        // The proxy owns the activity from here on, so a hit releases it together with the unused proxy.
+        auto pProxy{std::make_shared<TA_ActivityProxy>(pActivity, autoDelete)};
+        auto pExpiry{std::make_shared<Expiry>(std::chrono::steady_clock::time_point::max())};
+        auto pShared{acquire(makeKey(*pActivity), pProxy, pExpiry)};
+        if (pShared != pProxy) {
+            return {pShared};
+        }
+        if (m_ttl == std::chrono::milliseconds::zero()) {
+            return pool.postActivity(pProxy);
+        }
+        // The ttl counts from the moment the result is ready, so a computation longer than ttl is still cached.
+        auto pStamped = TA_ActivityCreator::create([pProxy, pExpiry, ttl = m_ttl]() {
+            (*pProxy)();
+            pExpiry->store(std::chrono::steady_clock::now() + ttl, std::memory_order_release);
+        });
+        pStamped->setStolenEnabled(pProxy->stolenEnabled());
+        pStamped->moveToThread(pProxy->affinityThread());
+        std::ignore = pool.postActivity(pStamped, true);
+        return {pProxy};
+    }
+
+    void clear();
+    std::size_t size() const;
+    std::size_t capacity() const { return m_capacity; }
+    std::chrono::milliseconds ttl() const { return m_ttl; }
+    Statistics statistics() const;
+
+  private:
+    struct Key {
+        std::size_t type;
+        std::size_t hash;
+        std::shared_ptr<const void> pValue;
+        bool (*equal)(const void *, const void *);
+
+        bool operator==(const Key &other) const {
+            return type == other.type && hash == other.hash && equal(pValue.get(), other.pValue.get());
+        }
+    };
+
+    struct KeyHash {
+        std::size_t operator()(const Key &key) const { return key.hash; }
+    };
+
+    using Expiry = std::atomic<std::chrono::steady_clock::time_point>;
+
+    struct Entry {
+        Key key;
+        std::shared_ptr<TA_ActivityProxy> pProxy;
+        std::shared_ptr<Expiry> pExpiry;
+    };
+
+    struct Shard {
+        mutable std::mutex mutex;
+        std::list<Entry> entries;
+        std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index;
+    };
+
+    template <typename T> static void hashValue(std::size_t &seed, const T &value) {
+        std::size_t hash{0};
+        if constexpr (!std::is_empty_v<T> && !std::is_member_pointer_v<T>) {
+            hash = std::hash<T>{}(value);
+        }
+        seed ^= hash + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+    }
+
+    template <typename T> static bool equalValue(const T &lhs, const T &rhs) {
+        if constexpr (std::is_empty_v<T>) {
+            return true;
+        } else {
+            return lhs == rhs;
+        }
+    }
+
+    template <typename Tuple> static Key makeTupleKey(std::size_t type, Tuple &&values) {
+        using Stored = std::decay_t<Tuple>;
+        Key key{type, type, std::make_shared<const Stored>(std::forward<Tuple>(values)),
+                [](const void *pLhs, const void *pRhs) {
+                    return std::apply(
+                        [pRhs](const auto &...lhs) {
+                            return std::apply(
+                                [&lhs...](const auto &...rhs) { return (equalValue(lhs, rhs) && ...); },
+                                *static_cast<const Stored *>(pRhs));
+                        },
+                        *static_cast<const Stored *>(pLhs));
+                }};
+        std::apply([&key](const auto &...value) { (hashValue(key.hash, value), ...); },
+                   *static_cast<const Stored *>(key.pValue.get()));
+        return key;
+    }
+
+    template <typename Method, typename... Args> static Key makeKey(const TA_MethodActivity<Method, Args...> &activity) {
+        static_assert((MemoizableValue<std::decay_t<Method>> && ... && MemoizableValue<std::decay_t<Args>>),
+                      "The callable and the arguments of a memoized activity must be hashable and comparable.");
+        return makeTupleKey(typeid(TA_MethodActivity<Method, Args...>).hash_code(),
+                            std::apply(
+                                [&activity](const auto &...args) {
+                                    return std::tuple<std::decay_t<Method>, std::decay_t<Args>...>{activity.method(),
+                                                                                                   args...};
+                                },
+                                activity.args()));
+    }
+
+    template <typename MethodName, typename... Paras>
+    static Key makeKey(const TA_MetaActivity<MethodName, Paras...> &activity) {
+        static_assert((MemoizableValue<std::decay_t<Paras>> && ...),
+                      "The arguments of a memoized activity must be hashable and comparable.");
+        return makeTupleKey(typeid(TA_MetaActivity<MethodName, Paras...>).hash_code(),
+                            std::apply([](const auto &...paras) { return std::tuple<std::decay_t<Paras>...>{paras...}; },
+                                       activity.paras()));
+    }
+
+    std::shared_ptr<TA_ActivityProxy> acquire(Key &&key, const std::shared_ptr<TA_ActivityProxy> &pProxy,
+                                              const std::shared_ptr<Expiry> &pExpiry);
+
+  private:
+    const std::size_t m_capacity;
+    const std::size_t m_shardCapacity;
+    const std::chrono::milliseconds m_ttl;
+    std::vector<Shard> m_shards;
+    std::atomic_size_t m_hits{0};
+    std::atomic_size_t m_coalesced{0};
+    std::atomic_size_t m_misses{0};
+    std::atomic_size_t m_evictions{0};
+};
+} // namespace CoreAsync
+
+#endif // TA_ACTIVITYCACHE_H
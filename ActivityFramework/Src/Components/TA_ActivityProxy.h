@@ -57,6 +57,15 @@ class TA_ActivityProxy : public std::enable_shared_from_this<TA_ActivityProxy> {
                     var.set(static_cast<RawActivity *>(pObj.get())->operator()());
                 promise.set_value(std::move(var));
             };
+            m_pInvokeExp = [](auto const &pObj) -> TA_DefaultVariant {
+                TA_DefaultVariant var;
+                if constexpr (std::is_void_v<Ret>) {
+                    static_cast<RawActivity *>(pObj.get())->operator()();
+                    var.set(nullptr);
+                } else
+                    var.set(static_cast<RawActivity *>(pObj.get())->operator()());
+                return var;
+            };
             m_pAffinityThreadExp = [](auto const &pObj) -> std::size_t {
                 return static_cast<RawActivity *>(pObj.get())->affinityThread();
             };
@@ -82,6 +91,7 @@ class TA_ActivityProxy : public std::enable_shared_from_this<TA_ActivityProxy> {
     TA_ActivityProxy(TA_ActivityProxy &&other) noexcept
         : m_pActivity(std::exchange(other.m_pActivity, nullptr)),
           m_pExecuteExp(std::exchange(other.m_pExecuteExp, nullptr)),
+          m_pInvokeExp(std::exchange(other.m_pInvokeExp, nullptr)),
           m_pAffinityThreadExp(std::exchange(other.m_pAffinityThreadExp, nullptr)),
           m_pDependThreadIdExp(std::exchange(other.m_pDependThreadIdExp, nullptr)),
           m_pIdExp(std::exchange(other.m_pIdExp, nullptr)),
@@ -96,6 +106,7 @@ class TA_ActivityProxy : public std::enable_shared_from_this<TA_ActivityProxy> {
         if (this != &other) {
             m_pActivity = std::exchange(other.m_pActivity, nullptr);
             m_pExecuteExp = std::exchange(other.m_pExecuteExp, nullptr);
+            m_pInvokeExp = std::exchange(other.m_pInvokeExp, nullptr);
             m_pAffinityThreadExp = std::exchange(other.m_pAffinityThreadExp, nullptr);
             m_pDependThreadIdExp = std::exchange(other.m_pDependThreadIdExp, nullptr);
             m_pIdExp = std::exchange(other.m_pIdExp, nullptr);
@@ -127,12 +138,45 @@ class TA_ActivityProxy : public std::enable_shared_from_this<TA_ActivityProxy> {
         bool expected{false};
         if (m_isExecuted.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
             m_pExecuteExp(m_pActivity, std::move(m_promise));
-            m_pExecuteExp = nullptr;
         }
     }
 
     bool isExecuted() const { return m_isExecuted.load(std::memory_order_acquire); }
 
+    // Completes the proxy with a result produced outside of operator(), e.g. by invoke() on another thread.
+    bool complete(TA_DefaultVariant var) {
+        bool expected{false};
+        if (!m_isExecuted.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+            return false;
+        }
+        m_promise.set_value(std::move(var));
+        return true;
+    }
+
+    bool isReady() const {
+        return m_future.valid() && m_future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+
+    // Runs the wrapped activity and returns its result without touching the promise, so a shared proxy can be
+    // invoked any number of times and from several threads, as long as the activity itself allows it.
+    TA_DefaultVariant invoke() const {
+        if (!m_pInvokeExp || !m_pActivity) {
+            throw std::runtime_error("Execute function or activity is null");
+        }
+        return m_pInvokeExp(m_pActivity);
+    }
+
+    // Re-arms an executed proxy so that the wrapped activity can run again. Must not race with operator().
+    bool reset() {
+        if (!m_pExecuteExp || !m_pActivity || !m_isExecuted.load(std::memory_order_acquire)) {
+            return false;
+        }
+        m_promise = std::promise<TA_DefaultVariant>{};
+        m_future = m_promise.get_future().share();
+        m_isExecuted.store(false, std::memory_order_release);
+        return true;
+    }
+
     std::size_t affinityThread() const { return m_pAffinityThreadExp(m_pActivity); }
 
     std::thread::id dependencyThreadId() const { return m_pDependThreadIdExp(m_pActivity); }
@@ -148,6 +192,7 @@ class TA_ActivityProxy : public std::enable_shared_from_this<TA_ActivityProxy> {
   private:
     std::unique_ptr<void, void (*)(void *)> m_pActivity;
     Executor<void, std::unique_ptr<void, void (*)(void *)> &, std::promise<TA_DefaultVariant> &&> m_pExecuteExp{nullptr};
+    Executor<TA_DefaultVariant, std::unique_ptr<void, void (*)(void *)> const &> m_pInvokeExp{nullptr};
     Executor<std::size_t, std::unique_ptr<void, void (*)(void *)> const &> m_pAffinityThreadExp{nullptr};
     Executor<std::thread::id, std::unique_ptr<void, void (*)(void *)> const &> m_pDependThreadIdExp{nullptr};
     Executor<std::int64_t, std::unique_ptr<void, void (*)(void *)> const &> m_pIdExp{nullptr};
@@ -20,6 +20,7 @@
 #include <atomic>
 #include <array>
 #include <stdexcept>
+#include <thread>
 
 namespace CoreAsync {
 template <typename T, std::size_t N> class TA_ActivityQueue {
@@ -69,7 +70,7 @@ template <typename T, std::size_t N> class TA_ActivityQueue {
                 return false;
         } while (!m_rearIndex.compare_exchange_weak(rearIndexOld, rearIndexNew, std::memory_order_acq_rel));
 
-        m_data[rearIndexOld].exchange(t);
+        publish(rearIndexOld, t);
         return true;
     }
 
@@ -82,7 +83,7 @@ template <typename T, std::size_t N> class TA_ActivityQueue {
                 return false;
         } while (!m_rearIndex.compare_exchange_weak(rearIndexOld, rearIndexNew, std::memory_order_acq_rel));
 
-        m_data[rearIndexOld].exchange(t);
+        publish(rearIndexOld, t);
         return true;
     }
 
@@ -95,7 +96,12 @@ template <typename T, std::size_t N> class TA_ActivityQueue {
             frontIndexNew = (frontIndexOld + 1) % N;
         } while (!m_frontIndex.compare_exchange_weak(frontIndexOld, frontIndexNew, std::memory_order_acq_rel));
 
+        // The producer claims its slot before it writes it, wait until the element has been published.
+        while (!m_ready[frontIndexOld].load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
         t = m_data[frontIndexOld].load(std::memory_order_acquire);
+        m_ready[frontIndexOld].store(false, std::memory_order_release);
         return true;
     }
 
@@ -104,6 +110,9 @@ template <typename T, std::size_t N> class TA_ActivityQueue {
         if (frontIndex == m_rearIndex.load(std::memory_order_acquire)) {
             return false; // Queue is empty
         }
+        if (!m_ready[frontIndex].load(std::memory_order_acquire)) {
+            return false; // Not published yet
+        }
         t= m_data[frontIndex].load(std::memory_order_acquire);
         return true;
     }
@@ -117,7 +126,17 @@ template <typename T, std::size_t N> class TA_ActivityQueue {
     }
 
   private:
+    void publish(std::size_t index, const T &t) {
+        // After a wrap around the consumer of the previous round may still be reading the slot.
+        while (m_ready[index].load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+        m_data[index].store(t, std::memory_order_release);
+        m_ready[index].store(true, std::memory_order_release);
+    }
+
     std::array<std::atomic<T>, N> m_data{};
+    std::array<std::atomic_bool, N> m_ready{};
     std::atomic<std::size_t> m_frontIndex{0}, m_rearIndex{0};
 };
 } // namespace CoreAsync
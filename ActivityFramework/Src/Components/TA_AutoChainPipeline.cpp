@@ -19,20 +19,45 @@
 namespace CoreAsync {
 TA_AutoChainPipeline::TA_AutoChainPipeline() : TA_BasicPipeline() {}
 
-TA_CoroutineGenerator<TA_DefaultVariant, CoreAsync::Eager> runningGenerator(TA_AutoChainPipeline *pPipeline) {
-    for (auto i = pPipeline->startIndex(); i < pPipeline->m_pActivityList.size(); ++i) {
-        decltype(auto) pActivity{TA_CommonTools::at<std::shared_ptr<TA_ActivityProxy>>(pPipeline->m_pActivityList, i)};
-        (*pActivity)();
-        auto var{pActivity->result()};
-        TA_CommonTools::replace(pPipeline->m_resultList, i, var);
+TA_CoroutineGenerator<TA_DefaultVariant, CoreAsync::Eager> runningGenerator(TA_AutoChainPipeline *pPipeline,
+                                                                            unsigned int from) {
+    for (auto i = from; i < pPipeline->m_pActivityList.size(); ++i) {
+        auto var{pPipeline->runStage(i)};
+        if (var.isSameType<TA_BasicPipeline::SuspendableStage>()) {
+            // The worker is released here, the rest of the chain runs on the thread that finishes the stage.
+            auto stage{var.get<TA_BasicPipeline::SuspendableStage>()};
+            stage.start([pPipeline, stage, i]() {
+                if (stage.exception()) {
+                    TA_CommonTools::debugInfo(META_STRING("Suspendable stage %d threw an exception!"), i);
+                }
+                if (pPipeline->m_pProfile) {
+                    pPipeline->m_pProfile->stageFinished(i);
+                }
+                pPipeline->m_resultList[i] = stage.result().value_or(TA_DefaultVariant{});
+                auto generator{runningGenerator(pPipeline, i + 1)};
+                while (generator.next())
+                    ;
+            });
+            co_return;
+        }
+        pPipeline->m_resultList[i] = var;
         co_yield var;
     }
     pPipeline->setState(TA_BasicPipeline::State::Ready);
     co_return;
 }
 
+std::shared_ptr<const TA_PipelineInstance::Definition> TA_AutoChainPipeline::definition() {
+    std::lock_guard<std::recursive_mutex> locker(m_mutex);
+    return std::make_shared<const TA_PipelineInstance::Definition>(m_pActivityList);
+}
+
+std::shared_ptr<TA_PipelineInstance> TA_AutoChainPipeline::createInstance(TA_DefaultVariant input) {
+    return TA_PipelineInstance::create(definition(), std::move(input));
+}
+
 void TA_AutoChainPipeline::run() {
-    auto generator{runningGenerator(this)};
+    auto generator{runningGenerator(this, startIndex())};
     while (generator.next())
         ;
 }
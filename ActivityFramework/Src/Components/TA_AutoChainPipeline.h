@@ -18,6 +18,7 @@
 #define TA_AUTOCHAINPIPELINE_H
 
 #include "TA_BasicPipeline.h"
+#include "TA_PipelineInstance.h"
 
 namespace CoreAsync {
 class TA_AutoChainPipeline : public TA_BasicPipeline {
@@ -29,6 +30,10 @@ class TA_AutoChainPipeline : public TA_BasicPipeline {
     TA_AutoChainPipeline(TA_AutoChainPipeline &&activity) = delete;
     TA_AutoChainPipeline &operator=(const TA_AutoChainPipeline &) = delete;
 
+    // Snapshot of the current stages, later changes to the pipeline don't affect it.
+    ACTIVITY_FRAMEWORK_EXPORT std::shared_ptr<const TA_PipelineInstance::Definition> definition();
+    ACTIVITY_FRAMEWORK_EXPORT std::shared_ptr<TA_PipelineInstance> createInstance(TA_DefaultVariant input = {});
+
   protected:
     virtual void run() override final;
 };
@@ -17,9 +17,61 @@
 #include "Components/TA_BasicPipeline.h"
 #include "Components/TA_CommonTools.h"
 
+#include <algorithm>
 #include <cassert>
+#include <condition_variable>
+#include <optional>
 
 namespace CoreAsync {
+namespace {
+thread_local std::stop_token currentStopToken{};
+
+struct StageRace {
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::optional<TA_DefaultVariant> result;
+    std::chrono::microseconds latency{0};
+    std::exception_ptr exception{nullptr};
+    std::size_t launched{0}, failed{0};
+    std::array<std::stop_source, 2> sources;
+};
+
+void launchAttempt(const std::shared_ptr<StageRace> &pRace, const std::shared_ptr<TA_ActivityProxy> &pActivity) {
+    const std::size_t attempt{pRace->launched++};
+    auto pAttempt = TA_ActivityCreator::create([pRace, pActivity, attempt]() {
+        const auto start{std::chrono::steady_clock::now()};
+        currentStopToken = pRace->sources[attempt].get_token();
+        TA_DefaultVariant var;
+        std::exception_ptr exception{nullptr};
+        try {
+            var = pActivity->invoke();
+        } catch (...) {
+            exception = std::current_exception();
+        }
+        currentStopToken = {};
+        std::lock_guard<std::mutex> locker(pRace->mutex);
+        if (pRace->result) {
+            return;
+        }
+        if (exception) {
+            if (!pRace->exception) {
+                pRace->exception = exception;
+            }
+            ++pRace->failed;
+        } else {
+            pRace->result = std::move(var);
+            pRace->latency =
+                std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+            for (auto &source : pRace->sources) {
+                source.request_stop();
+            }
+        }
+        pRace->condition.notify_all();
+    });
+    [[maybe_unused]] auto fetcher = TA_ThreadHolder::get().postActivity(pAttempt, true);
+}
+} // namespace
+
 bool TA_BasicPipeline::remove(ActivityIndex index) {
     if (State::Waiting != m_state.load(std::memory_order_consume)) {
         assert(State::Waiting == m_state.load(std::memory_order_consume));
@@ -28,12 +80,35 @@ bool TA_BasicPipeline::remove(ActivityIndex index) {
     }
     std::lock_guard<std::recursive_mutex> locker(m_mutex);
     if (index < m_pActivityList.size()) {
-        TA_CommonTools::remove<std::shared_ptr<TA_ActivityProxy>>(m_pActivityList, index);
+        m_pActivityList.erase(m_pActivityList.begin() + index);
+        if (index < m_resultList.size()) {
+            m_resultList.erase(m_resultList.begin() + index);
+        }
+        // Controls stay with their stages, the ones behind the removed stage move down one index.
+        m_stageControls.erase(index);
+        std::vector<decltype(m_stageControls)::node_type> shifted;
+        for (auto iter = m_stageControls.begin(); iter != m_stageControls.end();) {
+            auto next = std::next(iter);
+            if (iter->first > index) {
+                shifted.emplace_back(m_stageControls.extract(iter));
+            }
+            iter = next;
+        }
+        for (auto &node : shifted) {
+            --node.key();
+            m_stageControls.insert(std::move(node));
+        }
         return true;
     }
     return false;
 }
 
+void TA_BasicPipeline::reserve(std::size_t size) {
+    std::lock_guard<std::recursive_mutex> locker(m_mutex);
+    m_pActivityList.reserve(size);
+    m_resultList.reserve(size);
+}
+
 void TA_BasicPipeline::clear() {
     if (State::Busy == m_state.load(std::memory_order_consume)) {
         assert(State::Busy != m_state.load(std::memory_order_consume));
@@ -45,6 +120,10 @@ void TA_BasicPipeline::clear() {
     m_resultList.clear();
     m_mutex.unlock();
     m_startIndex.store(0, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> locker(m_stageMutex);
+        m_stageControls.clear();
+    }
     setState(State::Waiting);
 }
 
@@ -73,9 +152,38 @@ void TA_BasicPipeline::reset() {
     setState(State::Waiting);
 }
 
+void TA_BasicPipeline::recycle() {
+    if (State::Busy == m_state.load(std::memory_order_consume)) {
+        assert(State::Busy != m_state.load(std::memory_order_consume));
+        TA_CommonTools::debugInfo(META_STRING("Recycle pipeline failed!"));
+        return;
+    }
+    clear();
+    m_startIndex.store(0, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> locker(m_stageMutex);
+        m_stageControls.clear();
+    }
+    m_pProfile.reset();
+    resetConfiguration();
+}
+
 void TA_BasicPipeline::setState(State state) {
+    if (State::Busy != state && m_pProfile) {
+        m_pProfile->endRun();
+    }
     m_state.store(state, std::memory_order_release);
     TA_Connection::active(this, &TA_BasicPipeline::stateChanged, m_state.load(std::memory_order_consume));
+    if (State::Busy != state) {
+        std::shared_ptr<Completion> pCompletion{nullptr};
+        {
+            std::lock_guard<std::mutex> locker(m_completionMutex);
+            pCompletion.swap(m_pCompletion);
+        }
+        if (pCompletion) {
+            pCompletion->complete();
+        }
+    }
 }
 
 TA_BasicPipeline::State TA_BasicPipeline::state() const { return m_state.load(std::memory_order_consume); }
@@ -94,4 +202,195 @@ void TA_BasicPipeline::setStartIndex(ActivityIndex index) {
 TA_BasicPipeline::ActivityIndex TA_BasicPipeline::startIndex() const {
     return m_startIndex.load(std::memory_order_acquire);
 }
+
+void TA_BasicPipeline::setStagePolicy(ActivityIndex index, StagePolicy policy) {
+    if (State::Busy == m_state.load(std::memory_order_consume)) {
+        assert(State::Busy != m_state.load(std::memory_order_consume));
+        TA_CommonTools::debugInfo(META_STRING("Set stage policy failed!"));
+        return;
+    }
+    std::lock_guard<std::mutex> locker(m_stageMutex);
+    m_stageControls[index].policy = policy;
+}
+
+TA_BasicPipeline::StagePolicy TA_BasicPipeline::stagePolicy(ActivityIndex index) const {
+    std::lock_guard<std::mutex> locker(m_stageMutex);
+    auto iter{m_stageControls.find(index)};
+    return iter != m_stageControls.end() ? iter->second.policy : StagePolicy{};
+}
+
+std::stop_token TA_BasicPipeline::stopToken() { return currentStopToken; }
+
+void TA_BasicPipeline::setProfilingEnabled(bool enabled) {
+    if (State::Busy == m_state.load(std::memory_order_consume)) {
+        assert(State::Busy != m_state.load(std::memory_order_consume));
+        TA_CommonTools::debugInfo(META_STRING("Set profiling failed!"));
+        return;
+    }
+    if (!enabled) {
+        m_pProfile.reset();
+    } else if (!m_pProfile) {
+        m_pProfile = std::make_shared<TA_PipelineProfile>();
+    }
+}
+
+std::vector<std::vector<TA_BasicPipeline::ActivityIndex>> TA_BasicPipeline::stageDependencies() const {
+    std::vector<std::vector<ActivityIndex>> dependencies(m_pActivityList.size());
+    for (ActivityIndex idx = 1; idx < dependencies.size(); ++idx) {
+        dependencies[idx].emplace_back(idx - 1);
+    }
+    return dependencies;
+}
+
+TA_DefaultVariant TA_BasicPipeline::outcome() {
+    std::lock_guard<std::recursive_mutex> locker(m_mutex);
+    return m_resultList.empty() ? TA_DefaultVariant{} : m_resultList.back();
+}
+
+TA_BasicPipeline::SuspendableStage TA_BasicPipeline::nestedStage(TA_BasicPipeline *pParent, TA_BasicPipeline *pChild) {
+    if (State::Ready == pChild->state()) {
+        pChild->reset();
+    }
+    // Concurrent and DAG parents block their pipeline thread until the run drains, the child must not queue behind it.
+    auto &pool = TA_ThreadHolder::get();
+    std::size_t parentThread{pParent->m_pRunningActivity->affinityThread()};
+    if (parentThread < pool.size() && pChild->m_pRunningActivity->affinityThread() == parentThread) {
+        std::size_t target{pool.topPriorityThread(pool.threadId(parentThread))};
+        if (target < pool.size()) {
+            pChild->m_pRunningActivity->moveToThread(target);
+        }
+    }
+    // The parent's worker is released while the child runs, the stage resumes on the child's completion.
+    co_await pChild->execute();
+    co_return pChild->outcome();
+}
+
+void TA_BasicPipeline::pushNested(TA_BasicPipeline *pChild) {
+    if (!pChild || pChild == this) {
+        assert(pChild && pChild != this);
+        TA_CommonTools::debugInfo(META_STRING("Nest pipeline failed!"));
+        return;
+    }
+    auto pActivity = TA_ActivityCreator::create([this, pChild]() { return nestedStage(this, pChild); });
+    push(pActivity);
+}
+
+TA_DefaultVariant TA_BasicPipeline::runStage(ActivityIndex index) {
+    if (m_pProfile) {
+        m_pProfile->chainStageEnqueued(index);
+        m_pProfile->stageStarted(index);
+        auto var{runStage(index, m_pActivityList[index])};
+        // A suspendable stage finishes in its completion callback.
+        if (!var.isSameType<SuspendableStage>()) {
+            m_pProfile->stageFinished(index);
+        }
+        return var;
+    }
+    return runStage(index, m_pActivityList[index]);
+}
+
+TA_DefaultVariant TA_BasicPipeline::runStageToCompletion(ActivityIndex index) {
+    auto var{runStage(index)};
+    if (!var.isSameType<SuspendableStage>()) {
+        return var;
+    }
+    auto stage{var.get<SuspendableStage>()};
+    auto pFinished{std::make_shared<std::atomic_bool>(false)};
+    stage.start([pFinished, pProfile = m_pProfile, index]() {
+        if (pProfile) {
+            pProfile->stageFinished(index);
+        }
+        pFinished->store(true, std::memory_order_release);
+        pFinished->notify_one();
+    });
+    pFinished->wait(false, std::memory_order_acquire);
+    if (stage.exception()) {
+        TA_CommonTools::debugInfo(META_STRING("Suspendable stage %d threw an exception!"), index);
+    }
+    return stage.result().value_or(TA_DefaultVariant{});
+}
+
+TA_DefaultVariant TA_BasicPipeline::runStage(ActivityIndex index, const std::shared_ptr<TA_ActivityProxy> &pActivity) {
+    if (!pActivity->isExecuted()) {
+        StagePolicy policy{};
+        {
+            std::lock_guard<std::mutex> locker(m_stageMutex);
+            auto iter{m_stageControls.find(index)};
+            if (iter != m_stageControls.end()) {
+                policy = iter->second.policy;
+            }
+        }
+        if (policy.hedging || policy.timeout.count() > 0) {
+            return runGuardedStage(pActivity, index, policy);
+        }
+    }
+    (*pActivity)();
+    return pActivity->result();
+}
+
+TA_DefaultVariant TA_BasicPipeline::runGuardedStage(const std::shared_ptr<TA_ActivityProxy> &pActivity,
+                                                    ActivityIndex index, const StagePolicy &policy) {
+    std::chrono::microseconds budget{0};
+    if (policy.hedging) {
+        std::lock_guard<std::mutex> locker(m_stageMutex);
+        budget = m_stageControls[index].hedgeBudget();
+    }
+    const auto start{std::chrono::steady_clock::now()};
+    auto pRace{std::make_shared<StageRace>()};
+    std::unique_lock<std::mutex> locker(pRace->mutex);
+    auto isFinished = [&pRace]() { return pRace->result || pRace->failed == pRace->launched; };
+    launchAttempt(pRace, pActivity);
+    const bool timed{policy.timeout.count() > 0};
+    if (budget.count() > 0 && (!timed || budget < policy.timeout)) {
+        if (!pRace->condition.wait_until(locker, start + budget, isFinished)) {
+            launchAttempt(pRace, pActivity);
+        }
+    }
+    bool finished{true};
+    if (timed) {
+        finished = pRace->condition.wait_until(locker, start + policy.timeout, isFinished);
+    } else {
+        pRace->condition.wait(locker, isFinished);
+    }
+    if (!finished) {
+        for (auto &source : pRace->sources) {
+            source.request_stop();
+        }
+        locker.unlock();
+        TA_CommonTools::debugInfo(META_STRING("Stage %d timed out!"), index);
+        TA_DefaultVariant var;
+        var.set(StageTimeout{});
+        pActivity->complete(var);
+        return var;
+    }
+    if (!pRace->result) {
+        auto exception{pRace->exception};
+        locker.unlock();
+        std::rethrow_exception(exception);
+    }
+    TA_DefaultVariant var{*pRace->result};
+    const auto latency{pRace->latency};
+    locker.unlock();
+    {
+        std::lock_guard<std::mutex> stageLocker(m_stageMutex);
+        m_stageControls[index].record(latency);
+    }
+    pActivity->complete(var);
+    return var;
+}
+
+void TA_BasicPipeline::StageControl::record(std::chrono::microseconds latency) {
+    samples[sampleCount++ % samples.size()] = latency;
+}
+
+std::chrono::microseconds TA_BasicPipeline::StageControl::hedgeBudget() const {
+    const std::size_t count{std::min(sampleCount, samples.size())};
+    if (count < minSamples) {
+        return policy.hedgeAfter;
+    }
+    auto sorted{samples};
+    auto percentile{sorted.begin() + (count * 95 + 99) / 100 - 1};
+    std::nth_element(sorted.begin(), percentile, sorted.begin() + count);
+    return *percentile;
+}
 } // namespace CoreAsync
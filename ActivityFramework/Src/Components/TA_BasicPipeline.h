@@ -17,15 +17,22 @@
 #ifndef TA_ACTIVITYPIPELINE_H
 #define TA_ACTIVITYPIPELINE_H
 
+#include <array>
 #include <atomic>
 #include <cassert>
+#include <chrono>
+#include <concepts>
 #include <mutex>
+#include <stop_token>
+#include <unordered_map>
+#include <vector>
 
 #include "TA_ActivityProxy.h"
 #include "TA_MetaReflex.h"
 #include "TA_MetaObject.h"
 #include "TA_Coroutine.h"
 #include "TA_Connection.h"
+#include "TA_PipelineProfile.h"
 
 namespace CoreAsync {
 
@@ -34,6 +41,9 @@ class TA_ManualChainPipeline;
 class TA_ManualStepsChainPipeline;
 class TA_ManualKeyActivityChainPipeline;
 class TA_ConcurrentPipeline;
+class TA_DagPipeline;
+
+template <typename Holder> class TA_MainPipelineHolder;
 
 class ACTIVITY_FRAMEWORK_EXPORT TA_BasicPipeline : public TA_MetaObject {
   protected:
@@ -41,7 +51,7 @@ class ACTIVITY_FRAMEWORK_EXPORT TA_BasicPipeline : public TA_MetaObject {
     using AsyncTask = TA_ManualCoroutineTask<TA_ActivityResultFetcher, CorotuineBehavior::Eager>;
 
     friend TA_CoroutineGenerator<TA_DefaultVariant, CoreAsync::Eager>
-    runningGenerator(TA_AutoChainPipeline *pPipeline);
+    runningGenerator(TA_AutoChainPipeline *pPipeline, unsigned int from);
     friend TA_CoroutineGenerator<TA_DefaultVariant, CoreAsync::Lazy>
     runningGenerator(TA_ManualChainPipeline *pPipeline);
     friend TA_CoroutineGenerator<TA_DefaultVariant, CoreAsync::Lazy>
@@ -50,6 +60,8 @@ class ACTIVITY_FRAMEWORK_EXPORT TA_BasicPipeline : public TA_MetaObject {
     runningGenerator(TA_ManualKeyActivityChainPipeline *pPipeline);
     friend TA_CoroutineGenerator<TA_DefaultVariant, CoreAsync::Eager>
     runningGenerator(TA_ConcurrentPipeline *pPipeline);
+    friend TA_CoroutineGenerator<TA_DefaultVariant, CoreAsync::Eager>
+    runningGenerator(TA_DagPipeline *pPipeline);
 
   public:
     using ActivityIndex = unsigned int;
@@ -57,32 +69,101 @@ class ACTIVITY_FRAMEWORK_EXPORT TA_BasicPipeline : public TA_MetaObject {
 
     enum class ExecuteType { Async, Sync };
 
+    // A stage whose activity returns this type suspends the chain until the task finishes, without holding a worker.
+    using SuspendableStage = TA_ContinuableTask<TA_DefaultVariant>;
+
+  private:
+    // Completion of one execute() call, shared by the pipeline and the Waiter it returned.
+    struct Completion {
+        bool subscribe(std::function<void()> callback) {
+            std::lock_guard<std::mutex> locker(m_mutex);
+            if (m_done.load(std::memory_order_acquire)) {
+                return false;
+            }
+            m_callbacks.emplace_back(std::move(callback));
+            return true;
+        }
+
+        void complete() {
+            std::vector<std::function<void()>> callbacks;
+            {
+                std::lock_guard<std::mutex> locker(m_mutex);
+                m_done.store(true, std::memory_order_release);
+                callbacks.swap(m_callbacks);
+            }
+            m_done.notify_all();
+            for (auto &callback : callbacks) {
+                auto pActivity = TA_ActivityCreator::create([callback = std::move(callback)]() { callback(); });
+                [[maybe_unused]] auto fetcher = TA_ThreadHolder::get().postActivity(pActivity, true);
+            }
+        }
+
+        bool isDone() const { return m_done.load(std::memory_order_acquire); }
+
+        void wait() const { m_done.wait(false, std::memory_order_acquire); }
+
+      private:
+        std::mutex m_mutex;
+        std::atomic_bool m_done{false};
+        std::vector<std::function<void()>> m_callbacks;
+    };
+
+  public:
+    // Can be waited on with operator(), awaited with co_await, or completed through then(). Awaiting coroutines and
+    // then() callbacks are resumed on the thread pool once the execution leaves the Busy state.
     struct Waiter {
-        Waiter(AsyncTask &&task) : m_task(std::move(task)) {}
+        Waiter(AsyncTask &&task, std::shared_ptr<Completion> pCompletion)
+            : m_task(std::move(task)), m_pCompletion(std::move(pCompletion)) {}
 
         Waiter(const Waiter &) = delete;
-        Waiter(Waiter &&other) noexcept : m_task(std::move(other.m_task)) {}
+        Waiter(Waiter &&other) noexcept : m_task(std::move(other.m_task)), m_pCompletion(std::move(other.m_pCompletion)) {}
 
         Waiter &operator=(const Waiter &) = delete;
         Waiter &operator=(Waiter &&other) noexcept {
             if (this != &other) {
                 m_task = std::move(other.m_task);
+                m_pCompletion = std::move(other.m_pCompletion);
             }
             return *this;
         }
 
         ~Waiter() = default;
 
-        TA_DefaultVariant operator()() { return m_task.get()(); }
+        TA_DefaultVariant operator()() {
+            m_pCompletion->wait();
+            return m_task.get()();
+        }
+
+        bool isDone() const { return m_pCompletion->isDone(); }
+
+        void then(std::function<void()> callback) {
+            if (!m_pCompletion->subscribe(callback)) {
+                callback();
+            }
+        }
+
+        bool await_ready() const noexcept { return m_pCompletion->isDone(); }
+
+        bool await_suspend(std::coroutine_handle<> handle) {
+            return m_pCompletion->subscribe([handle]() { handle.resume(); });
+        }
+
+        void await_resume() const noexcept {}
 
       private:
         AsyncTask m_task;
+        std::shared_ptr<Completion> m_pCompletion;
     };
 
   public:
     TA_BasicPipeline()
         : TA_MetaObject(), m_pRunningActivity(TA_ActivityCreator::create(
-              std::function<void()>([this]() { run(); }))) {
+              std::function<void()>([this]() {
+              if (m_pProfile) {
+                  m_pProfile->runStarted();
+              }
+              run();
+          }))) {
         m_pRunningActivity->moveToThread(affinityThread());
         m_pRunningActivity->setStolenEnabled(false);
     }
@@ -109,10 +190,18 @@ class ACTIVITY_FRAMEWORK_EXPORT TA_BasicPipeline : public TA_MetaObject {
     virtual bool remove(ActivityIndex index);
     virtual void clear();
 
-    Waiter execute(ExecuteType type = ExecuteType::Async) { return executeHelperFunc(type); }
+    void reserve(std::size_t size);
+
+    Waiter execute(ExecuteType type = ExecuteType::Async) {
+        auto pCompletion{std::make_shared<Completion>()};
+        return {executeHelperFunc(type, pCompletion), pCompletion};
+    }
 
     virtual void reset();
 
+    // Returns the pipeline to its freshly constructed state so that it can be reused, signal connections are kept.
+    void recycle();
+
     std::size_t activitySize() const;
 
     template <typename Res> bool result(int index, Res &res) {
@@ -136,13 +225,76 @@ class ACTIVITY_FRAMEWORK_EXPORT TA_BasicPipeline : public TA_MetaObject {
     void setState(State state);
     ActivityIndex startIndex() const;
 
+    // Result of a stage that ran past its hard timeout.
+    struct StageTimeout {};
+
+    // A hedged stage is duplicated on another worker once it runs longer than the p95 of its recent latencies, or
+    // than hedgeAfter until enough latencies are known, and the first result wins. Both attempts run the same
+    // activity, so hedging is only suitable for stages that are safe to run twice. A stage that passes a non-zero
+    // timeout completes with StageTimeout. Abandoned attempts are asked to stop through stopToken(). Policies apply
+    // to every pipeline type, but not to instances created from definition().
+    struct StagePolicy {
+        bool hedging{false};
+        std::chrono::milliseconds hedgeAfter{0};
+        std::chrono::milliseconds timeout{0};
+    };
+
+    void setStagePolicy(ActivityIndex index, StagePolicy policy);
+    StagePolicy stagePolicy(ActivityIndex index) const;
+
+    // Stop token of the hedged or timed stage attempt running on the calling thread.
+    static std::stop_token stopToken();
+
+    // Profiling costs a pointer check per stage while it is off.
+    void setProfilingEnabled(bool enabled);
+    std::shared_ptr<const TA_PipelineProfile> profile() const { return m_pProfile; }
+
+  protected:
+    TA_DefaultVariant runStage(ActivityIndex index);
+    TA_DefaultVariant runStage(ActivityIndex index, const std::shared_ptr<TA_ActivityProxy> &pActivity);
+
+    // Manual pipelines return every stage result to the caller of run(), so a suspendable stage is started and
+    // waited for on the pipeline thread instead of suspending the chain.
+    TA_DefaultVariant runStageToCompletion(ActivityIndex index);
+
+    // Restores the settings of a derived pipeline to their defaults when it is recycled.
+    virtual void resetConfiguration() {}
+
+    // Predecessors of every stage, the profile follows them to find the critical path of a run.
+    virtual std::vector<std::vector<ActivityIndex>> stageDependencies() const;
+
+    // Result handed to the parent when the pipeline runs as a nested stage: the result of the last stage.
+    virtual TA_DefaultVariant outcome();
+
   private:
-    AsyncTask executeHelperFunc(ExecuteType type = ExecuteType::Async) {
+    struct StageControl {
+        static constexpr std::size_t minSamples{20};
+
+        StagePolicy policy;
+        std::array<std::chrono::microseconds, 64> samples{};
+        std::size_t sampleCount{0};
+
+        void record(std::chrono::microseconds latency);
+        std::chrono::microseconds hedgeBudget() const;
+    };
+
+    TA_DefaultVariant runGuardedStage(const std::shared_ptr<TA_ActivityProxy> &pActivity, ActivityIndex index,
+                                      const StagePolicy &policy);
+
+    AsyncTask executeHelperFunc(ExecuteType type, std::shared_ptr<Completion> pCompletion) {
         if (State::Waiting != m_state.load(std::memory_order_consume)) {
             assert(State::Waiting == m_state.load(std::memory_order_consume));
             TA_CommonTools::debugInfo(META_STRING("Execute pipeline failed!"));
+            pCompletion->complete();
             co_return {};
         }
+        {
+            std::lock_guard<std::mutex> locker(m_completionMutex);
+            m_pCompletion = std::move(pCompletion);
+        }
+        if (m_pProfile) {
+            m_pProfile->beginRun(stageDependencies());
+        }
         setState(State::Busy);
         std::lock_guard<std::recursive_mutex> locker(m_mutex);
         std::shared_ptr<TA_ActivityExecutingAwaitable> executingAwaitable =
@@ -152,7 +304,8 @@ class ACTIVITY_FRAMEWORK_EXPORT TA_BasicPipeline : public TA_MetaObject {
         co_return fetcher;
     }
 
-    template <ActivityType Activity, ActivityType... Activities>
+    template <typename Activity, typename... Activities>
+        requires(sizeof...(Activities) > 0)
     void push(Activity *&activity, Activities *&...activities) {
         push(activity);
         push(activities...);
@@ -165,17 +318,37 @@ class ACTIVITY_FRAMEWORK_EXPORT TA_BasicPipeline : public TA_MetaObject {
         }
     }
 
+    // A pipeline or pipeline holder added as a stage runs as a child pipeline without holding a worker, and the stage
+    // result is the child's outcome(). Nested pipelines are not owned by the parent and have to outlive it.
+    template <typename Pipeline>
+        requires std::derived_from<Pipeline, TA_BasicPipeline>
+    void push(Pipeline *&pChild) {
+        pushNested(pChild);
+    }
+
+    template <typename Holder> void push(TA_MainPipelineHolder<Holder> *&pHolder) {
+        pushNested(pHolder ? pHolder->m_pBasicPipeline : nullptr);
+    }
+
+    void pushNested(TA_BasicPipeline *pChild);
+    static SuspendableStage nestedStage(TA_BasicPipeline *pParent, TA_BasicPipeline *pChild);
+
     void destroy();
 
   protected:
-    std::list<std::shared_ptr<TA_ActivityProxy>> m_pActivityList;
+    std::vector<std::shared_ptr<TA_ActivityProxy>> m_pActivityList;
     std::vector<TA_DefaultVariant> m_resultList;
     std::recursive_mutex m_mutex;
     TA_MethodActivity<std::function<void()>> *m_pRunningActivity{nullptr};
+    std::shared_ptr<TA_PipelineProfile> m_pProfile{nullptr};
 
   private:
     std::atomic<State> m_state{State::Waiting};
+    std::mutex m_completionMutex;
+    std::shared_ptr<Completion> m_pCompletion{nullptr};
     std::atomic<ActivityIndex> m_startIndex{0};
+    mutable std::mutex m_stageMutex;
+    std::unordered_map<ActivityIndex, StageControl> m_stageControls;
 
     TA_Signals : void stateChanged(TA_BasicPipeline::State st) { std::ignore = st; };
     void activityCompleted(ActivityIndex index, TA_DefaultVariant res) {
@@ -195,8 +368,13 @@ template <> struct ACTIVITY_FRAMEWORK_EXPORT TA_TypeInfo<TA_BasicPipeline> : TA_
         TA_MetaField{&Raw::setStartIndex, META_STRING("setStartIndex")},
         TA_MetaField{&Raw::remove, META_STRING("remove")},
         TA_MetaField{&Raw::clear, META_STRING("clear")},
+        TA_MetaField{&Raw::reserve, META_STRING("reserve")},
         TA_MetaField{&Raw::execute, META_STRING("execute")},
         TA_MetaField{&Raw::reset, META_STRING("reset")},
+        TA_MetaField{&Raw::setStagePolicy, META_STRING("setStagePolicy")},
+        TA_MetaField{&Raw::stagePolicy, META_STRING("stagePolicy")},
+        TA_MetaField{&Raw::setProfilingEnabled, META_STRING("setProfilingEnabled")},
+        TA_MetaField{&Raw::profile, META_STRING("profile")},
         TA_MetaField{&Raw::activitySize, META_STRING("activitySize")},
         TA_MetaField{&Raw::state, META_STRING("state")},
         TA_MetaField{&Raw::stateChanged, META_STRING("stateChanged")},
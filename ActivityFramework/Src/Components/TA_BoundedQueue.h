@@ -0,0 +1,112 @@
+/*
+ * Copyright [2025] [Shuang Zhu / Sol]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TA_BOUNDEDQUEUE_H
+#define TA_BOUNDEDQUEUE_H
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <memory>
+
+namespace CoreAsync {
+/*
+ * Bounded multi-producer multi-consumer queue with a capacity fixed at construction. Every cell carries a sequence
+ * number that tells producers and consumers whether it is free or filled for the current lap, so push and pop only
+ * contend on a single index each and never take a lock.
+ */
+template <typename T> class TA_BoundedQueue {
+  public:
+    explicit TA_BoundedQueue(std::size_t capacity)
+        : m_mask(std::bit_ceil(std::max<std::size_t>(capacity, 2)) - 1),
+          m_pCells(std::make_unique<Cell[]>(m_mask + 1)) {
+        for (std::size_t idx = 0; idx <= m_mask; ++idx) {
+            m_pCells[idx].sequence.store(idx, std::memory_order_relaxed);
+        }
+    }
+
+    TA_BoundedQueue(const TA_BoundedQueue &queue) = delete;
+    TA_BoundedQueue(TA_BoundedQueue &&queue) = delete;
+
+    TA_BoundedQueue &operator=(const TA_BoundedQueue &queue) = delete;
+    TA_BoundedQueue &operator=(TA_BoundedQueue &&queue) = delete;
+
+    std::size_t capacity() const { return m_mask + 1; }
+
+    // Only a hint under concurrent access: an element whose push has not been published yet is not visible.
+    bool isEmpty() const {
+        std::size_t pos{m_dequeuePos.load(std::memory_order_acquire)};
+        return m_pCells[pos & m_mask].sequence.load(std::memory_order_acquire) != pos + 1;
+    }
+
+    template <typename U> bool push(U &&t) {
+        Cell *pCell;
+        std::size_t pos{m_enqueuePos.load(std::memory_order_relaxed)};
+        while (true) {
+            pCell = &m_pCells[pos & m_mask];
+            std::size_t seq{pCell->sequence.load(std::memory_order_acquire)};
+            auto diff{static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos)};
+            if (diff == 0) {
+                if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        pCell->data = std::forward<U>(t);
+        pCell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(T &t) {
+        Cell *pCell;
+        std::size_t pos{m_dequeuePos.load(std::memory_order_relaxed)};
+        while (true) {
+            pCell = &m_pCells[pos & m_mask];
+            std::size_t seq{pCell->sequence.load(std::memory_order_acquire)};
+            auto diff{static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1)};
+            if (diff == 0) {
+                if (m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        t = std::move(pCell->data);
+        pCell->sequence.store(pos + m_mask + 1, std::memory_order_release);
+        return true;
+    }
+
+  private:
+    struct Cell {
+        std::atomic_size_t sequence{0};
+        T data{};
+    };
+
+    const std::size_t m_mask;
+    std::unique_ptr<Cell[]> m_pCells;
+    alignas(64) std::atomic_size_t m_enqueuePos{0};
+    alignas(64) std::atomic_size_t m_dequeuePos{0};
+};
+} // namespace CoreAsync
+
+#endif // TA_BOUNDEDQUEUE_H
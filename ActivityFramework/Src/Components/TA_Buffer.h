@@ -17,7 +17,9 @@
 #ifndef TA_BUFFER_H
 #define TA_BUFFER_H
 
+#include <cstring>
 #include <fstream>
+#include <span>
 #include <vector>
 
 #include "TA_EndianConversion.h"
@@ -162,11 +164,102 @@ class TA_BufferWriter : public TA_BasicBufferOperator<TA_BufferWriter> {
     void init(const std::string &file) { m_fileStream.open(file, std::ios::binary | std::ios::out); }
 };
 
+class TA_MemoryBufferReader;
+class TA_MemoryBufferWriter;
+
+// Counterpart of TA_BasicBufferOperator on memory instead of a file, so values can be serialized into a message.
+template <typename Opt> class TA_BasicMemoryOperator {
+  public:
+    using OperatorType = Opt;
+
+    virtual ~TA_BasicMemoryOperator() = default;
+
+    TA_BasicMemoryOperator(const TA_BasicMemoryOperator &op) = delete;
+    TA_BasicMemoryOperator(TA_BasicMemoryOperator &&op) = delete;
+
+    bool isValid() const { return true; }
+
+    void close() {}
+
+    template <typename T> bool read(T &t) {
+        static_assert(std::is_same_v<Opt, TA_MemoryBufferReader>, "Read is not the member of current type");
+        return static_cast<Opt *>(this)->read(t);
+    }
+
+    template <typename T> bool write(T &t) {
+        static_assert(std::is_same_v<Opt, TA_MemoryBufferWriter>, "Write is not the member of current type");
+        return static_cast<Opt *>(this)->write(t);
+    }
+
+    void flush() {
+        static_assert(std::is_same_v<Opt, TA_MemoryBufferWriter>, "Flush is not the member of current type");
+    }
+
+  protected:
+    TA_BasicMemoryOperator() = default;
+};
+
+// Reads from memory it doesn't own, the data has to outlive the reader.
+class TA_MemoryBufferReader : public TA_BasicMemoryOperator<TA_MemoryBufferReader> {
+  public:
+    explicit TA_MemoryBufferReader(std::span<const char> data) : m_data(data) {}
+
+    TA_MemoryBufferReader(const TA_MemoryBufferReader &reader) = delete;
+    TA_MemoryBufferReader(TA_MemoryBufferReader &&reader) = delete;
+
+    template <EndianConvertedType T> bool read(T &t) {
+        if (m_data.size() - m_offset < sizeof(T))
+            return false;
+        memcpy(&t, m_data.data() + m_offset, sizeof(T));
+        m_offset += sizeof(T);
+        return true;
+    }
+
+    std::size_t remaining() const { return m_data.size() - m_offset; }
+
+  private:
+    std::span<const char> m_data;
+    std::size_t m_offset{0};
+};
+
+// Appends to a vector owned by the caller.
+class TA_MemoryBufferWriter : public TA_BasicMemoryOperator<TA_MemoryBufferWriter> {
+  public:
+    explicit TA_MemoryBufferWriter(std::vector<char> &buffer) : m_buffer(buffer) {}
+
+    TA_MemoryBufferWriter(const TA_MemoryBufferWriter &writer) = delete;
+    TA_MemoryBufferWriter(TA_MemoryBufferWriter &&writer) = delete;
+
+    TA_MemoryBufferWriter &operator=(const TA_MemoryBufferWriter &writer) = delete;
+    TA_MemoryBufferWriter &operator=(TA_MemoryBufferWriter &&writer) = delete;
+
+    template <EndianConvertedType T> bool write(T &t) {
+        const std::size_t offset{m_buffer.size()};
+        m_buffer.resize(offset + sizeof(std::remove_cvref_t<T>));
+        memcpy(m_buffer.data() + offset, &t, sizeof(std::remove_cvref_t<T>));
+        return true;
+    }
+
+  private:
+    std::vector<char> &m_buffer;
+};
+
 template <typename T>
 concept BufferOperatorType = requires() { typename T::OperatorType; };
 
 using BufferReader = TA_BasicBufferOperator<TA_BufferReader>;
 using BufferWriter = TA_BasicBufferOperator<TA_BufferWriter>;
+using MemoryBufferReader = TA_BasicMemoryOperator<TA_MemoryBufferReader>;
+using MemoryBufferWriter = TA_BasicMemoryOperator<TA_MemoryBufferWriter>;
+
+template <typename T>
+concept ReaderOperatorType = std::is_same_v<T, BufferReader> || std::is_same_v<T, MemoryBufferReader>;
+
+template <typename T>
+concept WriterOperatorType = std::is_same_v<T, BufferWriter> || std::is_same_v<T, MemoryBufferWriter>;
+
+template <typename T>
+concept MemoryOperatorType = std::is_same_v<T, MemoryBufferReader> || std::is_same_v<T, MemoryBufferWriter>;
 
 } // namespace CoreAsync
 
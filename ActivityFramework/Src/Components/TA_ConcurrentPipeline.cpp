@@ -18,18 +18,40 @@
 #include "Components/TA_CommonTools.h"
 
 namespace CoreAsync {
+struct TA_ConcurrentPipeline::RunState {
+    std::mutex mutex;
+    std::vector<std::pair<ActivityIndex, TA_DefaultVariant>> completed;
+    std::atomic_size_t completedCount{0};
+};
+
 TA_CoroutineGenerator<TA_DefaultVariant, CoreAsync::Eager> runningGenerator(TA_ConcurrentPipeline *pPipeline) {
-    std::vector<TA_ActivityResultFetcher> resultFetchers(pPipeline->m_pActivityList.size());
-    for (auto i = pPipeline->startIndex(); i < pPipeline->m_pActivityList.size(); ++i) {
-        decltype(auto) pActivity{TA_CommonTools::at<std::shared_ptr<TA_ActivityProxy>>(pPipeline->m_pActivityList, i)};
-        std::shared_ptr<TA_ActivityExecutingAwaitable> executingAwaitable =
-            std::make_shared<TA_ActivityExecutingAwaitable>(pActivity, TA_ActivityExecutingAwaitable::ExecuteType::Async);
-        resultFetchers[i] = co_await *executingAwaitable;
-    }
-    for (std::size_t idx = 0; idx < resultFetchers.size(); ++idx) {
-        pPipeline->m_resultList[idx] = resultFetchers[idx]();
-        TA_Connection::active(pPipeline, &TA_ConcurrentPipeline::activityCompleted, idx,
-                              std::forward<TA_DefaultVariant>(pPipeline->m_resultList[idx]));
+    auto pState{std::make_shared<TA_ConcurrentPipeline::RunState>()};
+    const std::size_t size{pPipeline->m_pActivityList.size()};
+    const std::size_t window{pPipeline->maxInFlight() == 0 ? size : pPipeline->maxInFlight()};
+    std::size_t next{pPipeline->startIndex()}, inFlight{0}, consumed{0};
+    std::vector<std::pair<TA_BasicPipeline::ActivityIndex, TA_DefaultVariant>> batch;
+    while (true) {
+        for (; next < size && inFlight < window; ++next, ++inFlight) {
+            pPipeline->post(pState, static_cast<TA_BasicPipeline::ActivityIndex>(next));
+        }
+        if (inFlight == 0) {
+            break;
+        }
+        std::size_t count{pState->completedCount.load(std::memory_order_acquire)};
+        while (count == consumed) {
+            pState->completedCount.wait(count, std::memory_order_acquire);
+            count = pState->completedCount.load(std::memory_order_acquire);
+        }
+        {
+            std::lock_guard<std::mutex> locker(pState->mutex);
+            batch.swap(pState->completed);
+            consumed = pState->completedCount.load(std::memory_order_relaxed);
+        }
+        for (const auto &[idx, var] : batch) {
+            pPipeline->collect(idx, var);
+        }
+        inFlight -= batch.size();
+        batch.clear();
     }
     pPipeline->m_pActivityList.clear();
     pPipeline->setState(TA_BasicPipeline::State::Ready);
@@ -42,6 +64,89 @@ void TA_ConcurrentPipeline::run() {
     auto generator{runningGenerator(this)};
 }
 
+std::vector<std::vector<TA_BasicPipeline::ActivityIndex>> TA_ConcurrentPipeline::stageDependencies() const {
+    return std::vector<std::vector<ActivityIndex>>(m_pActivityList.size());
+}
+
+void TA_ConcurrentPipeline::post(const std::shared_ptr<RunState> &pState, ActivityIndex index) {
+    auto &pool = TA_ThreadHolder::get();
+    decltype(auto) pProxy{m_pActivityList[index]};
+    auto affinity{pProxy->affinityThread()};
+    if (m_pProfile) {
+        m_pProfile->stageEnqueued(index);
+    }
+    auto finish = [pState, pProfile = m_pProfile, index](TA_DefaultVariant var) {
+        if (pProfile) {
+            pProfile->stageFinished(index);
+        }
+        {
+            std::lock_guard<std::mutex> locker(pState->mutex);
+            pState->completed.emplace_back(index, std::move(var));
+            pState->completedCount.fetch_add(1, std::memory_order_release);
+        }
+        pState->completedCount.notify_one();
+    };
+    auto pActivity = TA_ActivityCreator::create([this, pProxy, pProfile = m_pProfile, finish, index]() {
+        if (pProfile) {
+            pProfile->stageStarted(index);
+        }
+        auto var{runStage(index, pProxy)};
+        if (var.isSameType<SuspendableStage>()) {
+            // Nested pipelines and other suspendable stages give the worker back until they complete.
+            auto stage{var.get<SuspendableStage>()};
+            stage.start([finish, stage, index]() {
+                if (stage.exception()) {
+                    TA_CommonTools::debugInfo(META_STRING("Suspendable stage %d threw an exception!"), index);
+                }
+                finish(stage.result().value_or(TA_DefaultVariant{}));
+            });
+            return;
+        }
+        finish(std::move(var));
+    });
+    if (affinity < pool.size()) {
+        pActivity->moveToThread(affinity);
+    }
+    [[maybe_unused]] auto fetcher = pool.postActivity(pActivity, true);
+}
+
+void TA_ConcurrentPipeline::collect(ActivityIndex index, const TA_DefaultVariant &var) {
+    if (m_reducer) {
+        m_reducedResult = m_reducer(m_reducedResult, var);
+    }
+    if (!m_reducer || m_keepResults) {
+        m_resultList[index] = var;
+    }
+    TA_Connection::active(this, &TA_ConcurrentPipeline::activityCompleted, index, var);
+}
+
+TA_DefaultVariant TA_ConcurrentPipeline::outcome() {
+    std::lock_guard<std::recursive_mutex> locker(m_mutex);
+    return m_reducer ? m_reducedResult : TA_BasicPipeline::outcome();
+}
+
+void TA_ConcurrentPipeline::setMaxInFlight(std::size_t count) {
+    if (State::Busy == state()) {
+        assert(State::Busy != state());
+        TA_CommonTools::debugInfo(META_STRING("Set max in flight failed!"));
+        return;
+    }
+    m_maxInFlight.store(count, std::memory_order_release);
+}
+
+void TA_ConcurrentPipeline::setReducer(Reducer reducer, TA_DefaultVariant init, bool keepResults) {
+    if (State::Busy == state()) {
+        assert(State::Busy != state());
+        TA_CommonTools::debugInfo(META_STRING("Set reducer failed!"));
+        return;
+    }
+    std::lock_guard<std::recursive_mutex> locker(m_mutex);
+    m_reducer = std::move(reducer);
+    m_reducerInit = std::move(init);
+    m_reducedResult = m_reducerInit;
+    m_keepResults = keepResults;
+}
+
 void TA_ConcurrentPipeline::clear() {
     if (State::Busy == state()) {
         assert(State::Busy != state());
@@ -51,6 +156,7 @@ void TA_ConcurrentPipeline::clear() {
     m_mutex.lock();
     m_pActivityList.clear();
     m_resultList.clear();
+    m_reducedResult = m_reducerInit;
     m_mutex.unlock();
     setState(State::Waiting);
 }
@@ -64,7 +170,17 @@ void TA_ConcurrentPipeline::reset() {
     m_mutex.lock();
     m_resultList.clear();
     m_resultList.resize(m_pActivityList.size());
+    m_reducedResult = m_reducerInit;
     m_mutex.unlock();
     setState(State::Waiting);
 }
+
+void TA_ConcurrentPipeline::resetConfiguration() {
+    std::lock_guard<std::recursive_mutex> locker(m_mutex);
+    m_maxInFlight.store(0, std::memory_order_release);
+    m_reducer = nullptr;
+    m_reducerInit = {};
+    m_reducedResult = {};
+    m_keepResults = true;
+}
 } // namespace CoreAsync
@@ -19,9 +19,16 @@
 
 #include "TA_BasicPipeline.h"
 
+#include <functional>
+
 namespace CoreAsync {
 class ACTIVITY_FRAMEWORK_EXPORT TA_ConcurrentPipeline : public TA_BasicPipeline {
+    struct RunState;
+
   public:
+    // Folds results in completion order, so the operation should be associative and commutative.
+    using Reducer = std::function<TA_DefaultVariant(const TA_DefaultVariant &, const TA_DefaultVariant &)>;
+
     TA_ConcurrentPipeline();
     virtual ~TA_ConcurrentPipeline() {}
 
@@ -32,16 +39,55 @@ class ACTIVITY_FRAMEWORK_EXPORT TA_ConcurrentPipeline : public TA_BasicPipeline
     void clear() override final;
     void reset() override final;
 
+    void setMaxInFlight(std::size_t count);
+    std::size_t maxInFlight() const { return m_maxInFlight.load(std::memory_order_acquire); }
+
+    void setReducer(Reducer reducer, TA_DefaultVariant init = {}, bool keepResults = false);
+
+    template <typename Res> bool reducedResult(Res &res) {
+        if (State::Busy == state()) {
+            TA_CommonTools::debugInfo(META_STRING("Get reduced result from pipeline failed!"));
+            assert(State::Busy != state());
+            return false;
+        }
+        std::lock_guard<std::recursive_mutex> locker(m_mutex);
+        if (!m_reducer) {
+            return false;
+        }
+        res = m_reducedResult.template get<Res>();
+        return true;
+    }
+
   protected:
     void run() override final;
+    void resetConfiguration() override final;
+    std::vector<std::vector<ActivityIndex>> stageDependencies() const override final;
+    // The reduced result when a reducer is set.
+    TA_DefaultVariant outcome() override final;
+
+  private:
+    friend TA_CoroutineGenerator<TA_DefaultVariant, CoreAsync::Eager>
+    runningGenerator(TA_ConcurrentPipeline *pPipeline);
+
+    void post(const std::shared_ptr<RunState> &pState, ActivityIndex index);
+    void collect(ActivityIndex index, const TA_DefaultVariant &var);
 
+  private:
+    std::atomic_size_t m_maxInFlight{0};
+    Reducer m_reducer{nullptr};
+    TA_DefaultVariant m_reducerInit{};
+    TA_DefaultVariant m_reducedResult{};
+    bool m_keepResults{true};
 };
 
 namespace Reflex {
 template <>
 struct ACTIVITY_FRAMEWORK_EXPORT
     TA_TypeInfo<TA_ConcurrentPipeline> : TA_MetaTypeInfo<TA_ConcurrentPipeline, TA_BasicPipeline> {
-    static constexpr TA_MetaFieldList fields = {};
+    static constexpr TA_MetaFieldList fields = {
+        TA_MetaField{&Raw::setMaxInFlight, META_STRING("setMaxInFlight")},
+        TA_MetaField{&Raw::maxInFlight, META_STRING("maxInFlight")},
+    };
 };
 } // namespace Reflex
 } // namespace CoreAsync
@@ -37,6 +37,14 @@ class TA_Connection {
                                                  std::forward<LambdaExp>(lExp), type, autoDestroy);
     }
 
+    template <TA_ConnectionType type = TA_ConnectionType::Auto, EnableConnectObjectType Sender, typename SenderFunc,
+              std::ranges::input_range Receivers, typename ReceiverFunc>
+    static std::size_t connectMany(Sender *pSender, SenderFunc &&sFunc, Receivers &&receivers, ReceiverFunc &&rFunc) {
+        return TA_MetaObject::registerConnections(pSender, std::forward<SenderFunc>(sFunc),
+                                                  std::forward<Receivers>(receivers), std::forward<ReceiverFunc>(rFunc),
+                                                  type);
+    }
+
     template <EnableConnectObjectType Sender, typename SenderFunc, EnableConnectObjectType Receiver,
               typename ReceiverFunc>
     static constexpr bool disconnect(Sender *pSender, SenderFunc &&sFunc, Receiver *pReceiver, ReceiverFunc &&rFunc) {
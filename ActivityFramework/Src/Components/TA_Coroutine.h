@@ -21,6 +21,8 @@
 #include <coroutine>
 #include <optional>
 #include <exception>
+#include <functional>
+#include <memory>
 
 namespace CoreAsync {
 enum CorotuineBehavior { Lazy, Eager };
@@ -367,6 +369,71 @@ template <typename T> struct TA_CoroutineGenerator<T, Eager> {
     HandleType m_coroutineHandle;
 };
 
+// Lazy task that is started with a continuation instead of being waited on. The continuation runs on whichever thread
+// finishes the coroutine, so a task that suspends on I/O or another activity holds no worker while it is suspended.
+// Copies share the same coroutine frame, which is destroyed together with the last copy.
+template <typename T> struct TA_ContinuableTask {
+    struct promise_type {
+        std::optional<T> m_result{};
+        std::exception_ptr m_exception{};
+        std::function<void()> m_continuation{};
+
+        struct FinalAwaiter {
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<promise_type> h) noexcept {
+                auto continuation = std::move(h.promise().m_continuation);
+                if (continuation) {
+                    continuation();
+                }
+            }
+            void await_resume() noexcept {}
+        };
+
+        TA_ContinuableTask get_return_object() {
+            return TA_ContinuableTask{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        FinalAwaiter final_suspend() noexcept { return {}; }
+
+        template <typename U> void return_value(U &&value) { m_result = std::forward<U>(value); }
+
+        void unhandled_exception() { m_exception = std::current_exception(); }
+    };
+
+    using HandleType = std::coroutine_handle<promise_type>;
+
+    TA_ContinuableTask() = default;
+
+    explicit TA_ContinuableTask(HandleType handle)
+        : m_pFrame(handle.address(), [](void *pFrame) { HandleType::from_address(pFrame).destroy(); }) {}
+
+    bool isValid() const { return m_pFrame != nullptr; }
+
+    bool isDone() const { return m_pFrame && handle().done(); }
+
+    // A task that has already finished calls the continuation right away.
+    void start(std::function<void()> continuation) {
+        if (!m_pFrame || handle().done()) {
+            if (continuation) {
+                continuation();
+            }
+            return;
+        }
+        handle().promise().m_continuation = std::move(continuation);
+        handle().resume();
+    }
+
+    std::optional<T> result() const { return m_pFrame ? handle().promise().m_result : std::nullopt; }
+
+    std::exception_ptr exception() const { return m_pFrame ? handle().promise().m_exception : nullptr; }
+
+  private:
+    HandleType handle() const { return HandleType::from_address(m_pFrame.get()); }
+
+    std::shared_ptr<void> m_pFrame{nullptr};
+};
+
 } // namespace CoreAsync
 
 #endif // TA_COROUTINE_H
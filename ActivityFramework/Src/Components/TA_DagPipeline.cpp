@@ -0,0 +1,289 @@
+/*
+ * Copyright [2025] [Shuang Zhu / Sol]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Components/TA_DagPipeline.h"
+#include "Components/TA_CommonTools.h"
+
+#include <algorithm>
+
+namespace CoreAsync {
+TA_CoroutineGenerator<TA_DefaultVariant, CoreAsync::Eager> runningGenerator(TA_DagPipeline *pPipeline) {
+    auto pState{pPipeline->prepare()};
+    std::vector<TA_BasicPipeline::ActivityIndex> sources, local;
+    for (TA_BasicPipeline::ActivityIndex idx = 0; idx < pState->activities.size(); ++idx) {
+        if (pState->pending[idx].load(std::memory_order_acquire) == 0) {
+            sources.emplace_back(idx);
+        }
+    }
+    std::sort(sources.begin(), sources.end(),
+              [&pState](auto lhs, auto rhs) { return pState->ranks[lhs] > pState->ranks[rhs]; });
+    for (auto idx : sources) {
+        pPipeline->dispatch(pState, idx, local);
+    }
+    if (!local.empty()) {
+        pPipeline->drive(pState, std::move(local));
+    }
+    std::size_t remaining{pState->remaining.load(std::memory_order_acquire)};
+    while (remaining != 0) {
+        pState->remaining.wait(remaining, std::memory_order_acquire);
+        remaining = pState->remaining.load(std::memory_order_acquire);
+    }
+    pPipeline->setState(TA_BasicPipeline::State::Ready);
+    co_return;
+}
+
+TA_DagPipeline::TA_DagPipeline() : TA_BasicPipeline() {}
+
+void TA_DagPipeline::run() {
+    auto generator{runningGenerator(this)};
+}
+
+bool TA_DagPipeline::setPredecessors(ActivityIndex index, const std::vector<ActivityIndex> &predecessors) {
+    if (State::Waiting != state()) {
+        assert(State::Waiting == state());
+        TA_CommonTools::debugInfo(META_STRING("Set predecessors failed!"));
+        return false;
+    }
+    std::lock_guard<std::recursive_mutex> locker(m_mutex);
+    syncNodes();
+    if (index >= m_nodes.size()) {
+        return false;
+    }
+    std::vector<ActivityIndex> parents;
+    for (auto parent : predecessors) {
+        if (parent >= m_nodes.size() || parent == index) {
+            TA_CommonTools::debugInfo(META_STRING("Invalid predecessor!"));
+            return false;
+        }
+        if (std::find(parents.begin(), parents.end(), parent) == parents.end()) {
+            parents.emplace_back(parent);
+        }
+    }
+    auto previous{std::exchange(m_nodes[index].predecessors, std::move(parents))};
+    if (topologicalOrder().size() != m_nodes.size()) {
+        m_nodes[index].predecessors = std::move(previous);
+        TA_CommonTools::debugInfo(META_STRING("Dependency cycle detected!"));
+        return false;
+    }
+    return true;
+}
+
+std::vector<TA_BasicPipeline::ActivityIndex> TA_DagPipeline::predecessors(ActivityIndex index) const {
+    if (index < m_nodes.size()) {
+        return m_nodes[index].predecessors;
+    }
+    return {};
+}
+
+bool TA_DagPipeline::setCost(ActivityIndex index, std::size_t cost) {
+    if (State::Waiting != state()) {
+        assert(State::Waiting == state());
+        TA_CommonTools::debugInfo(META_STRING("Set cost failed!"));
+        return false;
+    }
+    std::lock_guard<std::recursive_mutex> locker(m_mutex);
+    syncNodes();
+    if (index >= m_nodes.size()) {
+        return false;
+    }
+    m_nodes[index].cost = cost;
+    return true;
+}
+
+bool TA_DagPipeline::remove(ActivityIndex index) {
+    std::lock_guard<std::recursive_mutex> locker(m_mutex);
+    syncNodes();
+    if (!TA_BasicPipeline::remove(index)) {
+        return false;
+    }
+    m_nodes.erase(m_nodes.begin() + index);
+    for (auto &node : m_nodes) {
+        std::erase(node.predecessors, index);
+        for (auto &parent : node.predecessors) {
+            if (parent > index) {
+                --parent;
+            }
+        }
+    }
+    return true;
+}
+
+void TA_DagPipeline::clear() {
+    std::lock_guard<std::recursive_mutex> locker(m_mutex);
+    TA_BasicPipeline::clear();
+    m_nodes.clear();
+}
+
+void TA_DagPipeline::reset() {
+    if (State::Ready != state()) {
+        assert(State::Ready == state());
+        TA_CommonTools::debugInfo(META_STRING("Reset pipeline failed!"));
+        return;
+    }
+    m_mutex.lock();
+    for (auto &pActivity : m_pActivityList) {
+        pActivity->reset();
+    }
+    m_mutex.unlock();
+    TA_BasicPipeline::reset();
+}
+
+std::vector<std::vector<TA_BasicPipeline::ActivityIndex>> TA_DagPipeline::stageDependencies() const {
+    std::vector<std::vector<ActivityIndex>> dependencies(m_pActivityList.size());
+    for (std::size_t idx = 0; idx < dependencies.size() && idx < m_nodes.size(); ++idx) {
+        dependencies[idx] = m_nodes[idx].predecessors;
+    }
+    return dependencies;
+}
+
+void TA_DagPipeline::syncNodes() {
+    if (m_nodes.size() < m_pActivityList.size()) {
+        m_nodes.resize(m_pActivityList.size());
+    }
+}
+
+std::vector<TA_BasicPipeline::ActivityIndex> TA_DagPipeline::topologicalOrder() const {
+    std::vector<std::size_t> inDegrees(m_nodes.size());
+    std::vector<std::vector<ActivityIndex>> successors(m_nodes.size());
+    for (ActivityIndex idx = 0; idx < m_nodes.size(); ++idx) {
+        inDegrees[idx] = m_nodes[idx].predecessors.size();
+        for (auto parent : m_nodes[idx].predecessors) {
+            successors[parent].emplace_back(idx);
+        }
+    }
+    std::vector<ActivityIndex> order;
+    order.reserve(m_nodes.size());
+    for (ActivityIndex idx = 0; idx < m_nodes.size(); ++idx) {
+        if (inDegrees[idx] == 0) {
+            order.emplace_back(idx);
+        }
+    }
+    for (std::size_t pos = 0; pos < order.size(); ++pos) {
+        for (auto child : successors[order[pos]]) {
+            if (--inDegrees[child] == 0) {
+                order.emplace_back(child);
+            }
+        }
+    }
+    return order;
+}
+
+std::shared_ptr<TA_DagPipeline::RunState> TA_DagPipeline::prepare() {
+    std::lock_guard<std::recursive_mutex> locker(m_mutex);
+    syncNodes();
+    auto pState{std::make_shared<RunState>(m_nodes.size())};
+    pState->activities.assign(m_pActivityList.begin(), m_pActivityList.end());
+    pState->successors.resize(m_nodes.size());
+    pState->ranks.resize(m_nodes.size());
+    pState->pipelineThread = TA_ThreadHolder::get().threadId(affinityThread());
+    for (ActivityIndex idx = 0; idx < m_nodes.size(); ++idx) {
+        pState->pending[idx].store(m_nodes[idx].predecessors.size(), std::memory_order_relaxed);
+        for (auto parent : m_nodes[idx].predecessors) {
+            pState->successors[parent].emplace_back(idx);
+        }
+    }
+    auto order{topologicalOrder()};
+    for (auto it = order.rbegin(); it != order.rend(); ++it) {
+        std::size_t rank{0};
+        for (auto child : pState->successors[*it]) {
+            rank = std::max(rank, pState->ranks[child]);
+        }
+        pState->ranks[*it] = rank + m_nodes[*it].cost;
+    }
+    return pState;
+}
+
+void TA_DagPipeline::dispatch(const std::shared_ptr<RunState> &pState, ActivityIndex index,
+                              std::vector<ActivityIndex> &local) {
+    if (m_pProfile) {
+        m_pProfile->stageEnqueued(index);
+    }
+    // The pipeline thread is blocked until the graph is drained, so nodes must never be queued on it.
+    auto &pool = TA_ThreadHolder::get();
+    std::size_t target{pool.topPriorityThread(pState->pipelineThread)};
+    if (target >= pool.size() || pool.threadId(target) == std::this_thread::get_id()) {
+        local.emplace_back(index);
+        return;
+    }
+    auto pActivity = TA_ActivityCreator::create([this, pState, index]() { drive(pState, {index}); });
+    pActivity->moveToThread(target);
+    [[maybe_unused]] auto fetcher = pool.postActivity(pActivity, true);
+}
+
+void TA_DagPipeline::drive(const std::shared_ptr<RunState> &pState, std::vector<ActivityIndex> local) {
+    while (!local.empty()) {
+        ActivityIndex index{local.back()};
+        local.pop_back();
+        decltype(auto) node{m_nodes[index]};
+        if (node.pInputs) {
+            node.pInputs->clear();
+            for (auto parent : node.predecessors) {
+                node.pInputs->emplace_back(m_resultList[parent]);
+            }
+        }
+        decltype(auto) pActivity{pState->activities[index]};
+        if (m_pProfile) {
+            m_pProfile->stageStarted(index);
+        }
+        auto var{runStage(index, pActivity)};
+        if (var.isSameType<SuspendableStage>()) {
+            // The node completes, and releases its successors, on the thread that finishes the stage.
+            auto stage{var.get<SuspendableStage>()};
+            stage.start([this, pState, stage, index]() {
+                if (stage.exception()) {
+                    TA_CommonTools::debugInfo(META_STRING("Suspendable stage %d threw an exception!"), index);
+                }
+                std::vector<ActivityIndex> resumed;
+                complete(pState, index, stage.result().value_or(TA_DefaultVariant{}), resumed);
+                drive(pState, std::move(resumed));
+            });
+            continue;
+        }
+        complete(pState, index, std::move(var), local);
+    }
+}
+
+void TA_DagPipeline::complete(const std::shared_ptr<RunState> &pState, ActivityIndex index, TA_DefaultVariant var,
+                              std::vector<ActivityIndex> &local) {
+    if (m_pProfile) {
+        m_pProfile->stageFinished(index);
+    }
+    m_resultList[index] = std::move(var);
+    TA_Connection::active(this, &TA_DagPipeline::activityCompleted, index, m_resultList[index]);
+
+    std::vector<ActivityIndex> ready;
+    for (auto child : pState->successors[index]) {
+        if (pState->pending[child].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            ready.emplace_back(child);
+        }
+    }
+    if (!ready.empty()) {
+        std::sort(ready.begin(), ready.end(),
+                  [&pState](auto lhs, auto rhs) { return pState->ranks[lhs] > pState->ranks[rhs]; });
+        for (auto it = std::next(ready.begin()); it != ready.end(); ++it) {
+            dispatch(pState, *it, local);
+        }
+        // The most critical child continues on this thread and reuses the parent's warm cache.
+        if (m_pProfile) {
+            m_pProfile->stageEnqueued(ready.front());
+        }
+        local.emplace_back(ready.front());
+    }
+    if (pState->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        pState->remaining.notify_all();
+    }
+}
+} // namespace CoreAsync
@@ -0,0 +1,123 @@
+/*
+ * Copyright [2025] [Shuang Zhu / Sol]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TA_DAGPIPELINE_H
+#define TA_DAGPIPELINE_H
+
+#include "TA_BasicPipeline.h"
+
+#include <vector>
+
+namespace CoreAsync {
+/*
+ * Runs activities as a dependency graph. An activity is released as soon as the in-degree counter of its
+ * predecessors reaches zero, and among the released ones the activity on the longest remaining path goes first.
+ * Nodes added by addNode receive the results of their predecessors, in declaration order.
+ */
+class ACTIVITY_FRAMEWORK_EXPORT TA_DagPipeline : public TA_BasicPipeline {
+  public:
+    using ParentResults = std::vector<TA_DefaultVariant>;
+
+    TA_DagPipeline();
+    virtual ~TA_DagPipeline() {}
+
+    TA_DagPipeline(const TA_DagPipeline &activity) = delete;
+    TA_DagPipeline(TA_DagPipeline &&activity) = delete;
+    TA_DagPipeline &operator=(const TA_DagPipeline &) = delete;
+
+    template <typename Fn>
+        requires std::invocable<Fn &, const ParentResults &>
+    ActivityIndex addNode(Fn fn, const std::vector<ActivityIndex> &predecessors = {}) {
+        if (State::Waiting != state()) {
+            assert(State::Waiting == state());
+            TA_CommonTools::debugInfo(META_STRING("Add node failed!"));
+            return static_cast<ActivityIndex>(activitySize());
+        }
+        std::lock_guard<std::recursive_mutex> locker(m_mutex);
+        auto pInputs{std::make_shared<ParentResults>()};
+        auto pActivity = TA_ActivityCreator::create(
+            [pInputs, fn = std::move(fn)]() mutable { return fn(std::as_const(*pInputs)); });
+        ActivityIndex index{static_cast<ActivityIndex>(activitySize())};
+        add(pActivity);
+        syncNodes();
+        m_nodes[index].pInputs = pInputs;
+        if (!setPredecessors(index, predecessors)) {
+            remove(index);
+            return static_cast<ActivityIndex>(activitySize());
+        }
+        return index;
+    }
+
+    bool setPredecessors(ActivityIndex index, const std::vector<ActivityIndex> &predecessors);
+    std::vector<ActivityIndex> predecessors(ActivityIndex index) const;
+    bool setCost(ActivityIndex index, std::size_t cost);
+
+    bool remove(ActivityIndex index) override final;
+    void clear() override final;
+    void reset() override final;
+
+  protected:
+    void run() override final;
+    std::vector<std::vector<ActivityIndex>> stageDependencies() const override final;
+
+  private:
+    struct Node {
+        std::vector<ActivityIndex> predecessors{};
+        std::size_t cost{1};
+        std::shared_ptr<ParentResults> pInputs{nullptr};
+    };
+
+    struct RunState {
+        explicit RunState(std::size_t size) : pending(size), remaining(size) {}
+
+        std::vector<std::shared_ptr<TA_ActivityProxy>> activities{};
+        std::vector<std::vector<ActivityIndex>> successors{};
+        std::vector<std::size_t> ranks{};
+        std::vector<std::atomic_size_t> pending;
+        std::atomic_size_t remaining;
+        std::thread::id pipelineThread{};
+    };
+
+    friend TA_CoroutineGenerator<TA_DefaultVariant, CoreAsync::Eager> runningGenerator(TA_DagPipeline *pPipeline);
+
+    void syncNodes();
+    std::vector<ActivityIndex> topologicalOrder() const;
+    std::shared_ptr<RunState> prepare();
+    void dispatch(const std::shared_ptr<RunState> &pState, ActivityIndex index, std::vector<ActivityIndex> &local);
+    void drive(const std::shared_ptr<RunState> &pState, std::vector<ActivityIndex> local);
+    void complete(const std::shared_ptr<RunState> &pState, ActivityIndex index, TA_DefaultVariant var,
+                  std::vector<ActivityIndex> &local);
+
+  private:
+    std::vector<Node> m_nodes;
+};
+
+namespace Reflex {
+template <>
+struct ACTIVITY_FRAMEWORK_EXPORT TA_TypeInfo<TA_DagPipeline> : TA_MetaTypeInfo<TA_DagPipeline, TA_BasicPipeline> {
+    static constexpr TA_MetaFieldList fields = {
+        TA_MetaField{&Raw::setPredecessors, META_STRING("setPredecessors")},
+        TA_MetaField{&Raw::predecessors, META_STRING("predecessors")},
+        TA_MetaField{&Raw::setCost, META_STRING("setCost")},
+        TA_MetaField{&Raw::remove, META_STRING("remove")},
+        TA_MetaField{&Raw::clear, META_STRING("clear")},
+        TA_MetaField{&Raw::reset, META_STRING("reset")},
+    };
+};
+} // namespace Reflex
+} // namespace CoreAsync
+
+#endif // TA_DAGPIPELINE_H
@@ -0,0 +1,139 @@
+/*
+ * Copyright [2025] [Shuang Zhu / Sol]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Components/TA_EpochDomain.h"
+
+#include <algorithm>
+
+namespace CoreAsync {
+struct TA_EpochDomain::RecordLease {
+    ~RecordLease() {
+        if (pRecord) {
+            TA_EpochDomain::get().releaseRecord(pRecord);
+        }
+    }
+
+    Record *pRecord{nullptr};
+};
+
+TA_EpochDomain &TA_EpochDomain::get() {
+    // Never destroyed, the records are handed back by threads that may outlive static destruction.
+    static TA_EpochDomain *pDomain = new TA_EpochDomain();
+    return *pDomain;
+}
+
+void TA_EpochDomain::retire(void *pObject, void (*deleter)(void *)) {
+    retire(pObject, deleter, nullptr);
+}
+
+void TA_EpochDomain::retire(void *pObject, void (*deleter)(void *), bool (*isReclaimable)(void *)) {
+    std::vector<Retired> reclaimable;
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        m_retired.emplace_back(Retired{pObject, deleter, isReclaimable, m_epoch.load(std::memory_order_acquire)});
+        reclaimable = collect();
+    }
+    for (auto &retired : reclaimable) {
+        retired.deleter(retired.pObject);
+    }
+}
+
+std::size_t TA_EpochDomain::reclaim() {
+    std::vector<Retired> reclaimable;
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        reclaimable = collect();
+    }
+    for (auto &retired : reclaimable) {
+        retired.deleter(retired.pObject);
+    }
+    return reclaimable.size();
+}
+
+std::size_t TA_EpochDomain::retiredCount() const {
+    std::lock_guard<std::mutex> locker(m_mutex);
+    return m_retired.size();
+}
+
+TA_EpochDomain::Record &TA_EpochDomain::localRecord() {
+    thread_local RecordLease lease;
+    if (!lease.pRecord) {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        auto iter = std::find_if(m_records.begin(), m_records.end(),
+                                 [](const std::unique_ptr<Record> &pRecord) { return !pRecord->inUse; });
+        if (iter != m_records.end()) {
+            (*iter)->inUse = true;
+            lease.pRecord = iter->get();
+        } else {
+            lease.pRecord = m_records.emplace_back(std::make_unique<Record>()).get();
+        }
+    }
+    return *lease.pRecord;
+}
+
+void TA_EpochDomain::releaseRecord(Record *pRecord) {
+    std::lock_guard<std::mutex> locker(m_mutex);
+    pRecord->nesting = 0;
+    pRecord->state.store(0, std::memory_order_release);
+    pRecord->inUse = false;
+}
+
+void TA_EpochDomain::enter() {
+    Record &record = localRecord();
+    if (record.nesting++ == 0) {
+        record.state.store((m_epoch.load(std::memory_order_relaxed) << 1) | 1, std::memory_order_relaxed);
+        // The announcement has to be visible before any shared pointer is read inside the critical section.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+}
+
+void TA_EpochDomain::leave() {
+    Record &record = localRecord();
+    if (--record.nesting == 0) {
+        record.state.store(0, std::memory_order_release);
+    }
+}
+
+// The epoch can only move on once every pinned thread has observed the current one. An object retired in epoch e
+// was unlinked before the epoch reached e + 1, so nobody can reach it anymore when the epoch reaches e + 2.
+bool TA_EpochDomain::tryAdvance() {
+    const std::uint64_t epoch{m_epoch.load(std::memory_order_relaxed)};
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    for (auto &pRecord : m_records) {
+        const std::uint64_t state{pRecord->state.load(std::memory_order_acquire)};
+        if ((state & 1) && (state >> 1) != epoch) {
+            return false;
+        }
+    }
+    m_epoch.store(epoch + 1, std::memory_order_release);
+    return true;
+}
+
+std::vector<TA_EpochDomain::Retired> TA_EpochDomain::collect() {
+    // Two steps at most, which is enough for everything retired before this call when no thread is pinned.
+    if (tryAdvance()) {
+        tryAdvance();
+    }
+    const std::uint64_t epoch{m_epoch.load(std::memory_order_relaxed)};
+    auto iter = std::partition(m_retired.begin(), m_retired.end(), [epoch](const Retired &retired) {
+        return retired.epoch + 2 > epoch || (retired.isReclaimable && !retired.isReclaimable(retired.pObject));
+    });
+    std::vector<Retired> reclaimable(iter, m_retired.end());
+    m_retired.erase(iter, m_retired.end());
+    m_retiredSize.store(m_retired.size(), std::memory_order_relaxed);
+    return reclaimable;
+}
+} // namespace CoreAsync
@@ -0,0 +1,117 @@
+/*
+ * Copyright [2025] [Shuang Zhu / Sol]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TA_EPOCHDOMAIN_H
+#define TA_EPOCHDOMAIN_H
+
+#include "TA_ActivityFramework_global.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace CoreAsync {
+/*
+ * Epoch-based reclamation for data that is read without locks.
+ *
+ * Readers pin the domain around a read-side critical section. A writer publishes a new version of the data and
+ * retires the old one, which is destroyed once every thread that could still hold it has unpinned. Pinning only
+ * touches a record owned by the calling thread, so readers never contend with each other or with writers. Pins nest.
+ *
+ * Queued slot calls pin the domain while they check their connection and run the slot, so a receiver retired by
+ * deleteLater() outlives every call that already reached it. A slot that blocks holds back every reclamation until it
+ * returns, activities outside slots don't.
+ */
+class ACTIVITY_FRAMEWORK_EXPORT TA_EpochDomain {
+  public:
+    class Guard {
+      public:
+        explicit Guard(TA_EpochDomain &domain) : m_domain(domain) { m_domain.enter(); }
+        ~Guard() { m_domain.leave(); }
+
+        Guard(const Guard &guard) = delete;
+        Guard &operator=(const Guard &guard) = delete;
+
+      private:
+        TA_EpochDomain &m_domain;
+    };
+
+    static TA_EpochDomain &get();
+
+    TA_EpochDomain(const TA_EpochDomain &domain) = delete;
+    TA_EpochDomain &operator=(const TA_EpochDomain &domain) = delete;
+
+    [[nodiscard]] Guard pin() { return Guard(*this); }
+
+    template <typename T> void retire(const T *pObject) {
+        if (pObject) {
+            retire(const_cast<T *>(pObject), [](void *pData) { delete static_cast<T *>(pData); });
+        }
+    }
+
+    void retire(void *pObject, void (*deleter)(void *));
+
+    // The object is also held back while isReclaimable returns false, it is asked again on every later collection.
+    void retire(void *pObject, void (*deleter)(void *), bool (*isReclaimable)(void *));
+
+    // Destroys the retired objects that no reader can reach anymore and returns how many were destroyed.
+    std::size_t reclaim();
+
+    std::size_t retiredCount() const;
+
+    bool hasRetired() const { return m_retiredSize.load(std::memory_order_relaxed) != 0; }
+
+  private:
+    struct alignas(64) Record {
+        // Epoch observed on entry shifted left by one, the lowest bit tells whether the thread is pinned.
+        std::atomic_uint64_t state{0};
+        std::size_t nesting{0};
+        bool inUse{true};
+    };
+
+    struct Retired {
+        void *pObject;
+        void (*deleter)(void *);
+        bool (*isReclaimable)(void *);
+        std::uint64_t epoch;
+    };
+
+    // Hands the record of a thread back to the domain when the thread exits.
+    struct RecordLease;
+
+    TA_EpochDomain() = default;
+    ~TA_EpochDomain() = default;
+
+    Record &localRecord();
+    void releaseRecord(Record *pRecord);
+
+    void enter();
+    void leave();
+
+    bool tryAdvance();
+    std::vector<Retired> collect();
+
+    std::atomic_uint64_t m_epoch{0};
+    mutable std::mutex m_mutex;
+    std::vector<std::unique_ptr<Record>> m_records;
+    std::vector<Retired> m_retired;
+    std::atomic_size_t m_retiredSize{0};
+};
+} // namespace CoreAsync
+
+#endif // TA_EPOCHDOMAIN_H
@@ -0,0 +1,88 @@
+/*
+ * Copyright [2025] [Shuang Zhu / Sol]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Components/TA_Mailbox.h"
+#include "Components/TA_Activity.h"
+#include "Components/TA_ThreadPool.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace CoreAsync {
+TA_Mailbox::TA_Mailbox(std::size_t capacity, TA_MailboxOverflow overflow, std::size_t quantum)
+    : m_messages(capacity), m_overflow(overflow), m_quantum(std::max<std::size_t>(quantum, 1)) {}
+
+bool TA_Mailbox::post(Message &&message, std::size_t thread) {
+    m_thread.store(thread, std::memory_order_relaxed);
+    while (!m_messages.push(std::move(message))) {
+        if (m_closed.load(std::memory_order_acquire)) {
+            return false;
+        }
+        if (m_overflow == TA_MailboxOverflow::DropOldest) {
+            Message oldest;
+            if (m_messages.pop(oldest)) {
+                m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+            }
+        } else if (m_overflow == TA_MailboxOverflow::Block &&
+                   TA_ThreadHolder::get().threadId(thread) != std::this_thread::get_id()) {
+            std::this_thread::yield();
+        } else {
+            m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+    }
+    // Only the transition from idle schedules a drain, the running drain picks up everything pushed before it ends.
+    if (!m_scheduled.exchange(true, std::memory_order_acq_rel)) {
+        schedule();
+    }
+    return true;
+}
+
+void TA_Mailbox::close() {
+    m_closed.store(true, std::memory_order_release);
+}
+
+void TA_Mailbox::schedule() {
+    auto activity = TA_ActivityCreator::create([pMailbox = shared_from_this()]() -> void { pMailbox->drain(); });
+    activity->setStolenEnabled(false);
+    activity->moveToThread(m_thread.load(std::memory_order_relaxed));
+    auto fetcher = TA_ThreadHolder::get().postActivity(activity, true);
+}
+
+void TA_Mailbox::drain() {
+    // A throwing message still hands the mailbox back, otherwise it would stay scheduled forever.
+    struct DrainScope {
+        ~DrainScope() { mailbox.finishDrain(); }
+        TA_Mailbox &mailbox;
+    } scope{*this};
+    m_drainCount.fetch_add(1, std::memory_order_relaxed);
+    Message message;
+    for (std::size_t count = 0; count < m_quantum && m_messages.pop(message); ++count) {
+        if (!m_closed.load(std::memory_order_acquire)) {
+            message();
+        }
+    }
+}
+
+void TA_Mailbox::finishDrain() {
+    // Both sides swap the flag, so either a producer sees the mailbox idle and schedules, or its message is visible
+    // here.
+    m_scheduled.exchange(false, std::memory_order_acq_rel);
+    if (!m_messages.isEmpty() && !m_scheduled.exchange(true, std::memory_order_acq_rel)) {
+        schedule();
+    }
+}
+} // namespace CoreAsync
@@ -0,0 +1,83 @@
+/*
+ * Copyright [2025] [Shuang Zhu / Sol]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TA_MAILBOX_H
+#define TA_MAILBOX_H
+
+#include "TA_ActivityFramework_global.h"
+#include "TA_BoundedQueue.h"
+
+#include <atomic>
+#include <functional>
+#include <memory>
+
+namespace CoreAsync {
+enum class TA_MailboxOverflow {
+    DropNewest, // The message that does not fit is rejected.
+    DropOldest, // The oldest pending message is discarded to make room.
+    Block       // The producer waits for room, unless it runs on the mailbox's own thread, then it is rejected.
+};
+
+/*
+ * Mailbox of an object running in actor mode. Producers on any thread push into a bounded lock-free queue, and the
+ * first push into an idle mailbox schedules a single drain activity on the owner's thread. A drain runs at most one
+ * quantum of messages in order and reschedules itself while messages are left, so a busy object yields its worker to
+ * other activities between quanta and never runs two messages at the same time.
+ */
+class ACTIVITY_FRAMEWORK_EXPORT TA_Mailbox : public std::enable_shared_from_this<TA_Mailbox> {
+  public:
+    using Message = std::function<void()>;
+
+    // The capacity is rounded up to a power of two.
+    TA_Mailbox(std::size_t capacity, TA_MailboxOverflow overflow, std::size_t quantum);
+
+    TA_Mailbox(const TA_Mailbox &mailbox) = delete;
+    TA_Mailbox(TA_Mailbox &&mailbox) = delete;
+
+    TA_Mailbox &operator=(const TA_Mailbox &mailbox) = delete;
+    TA_Mailbox &operator=(TA_Mailbox &&mailbox) = delete;
+
+    // Queues the message for the given thread. Returns false if the message was dropped or the mailbox is closed.
+    bool post(Message &&message, std::size_t thread);
+
+    // Pending and later messages are discarded without running.
+    void close();
+
+    std::size_t capacity() const { return m_messages.capacity(); }
+    std::size_t quantum() const { return m_quantum; }
+    TA_MailboxOverflow overflow() const { return m_overflow; }
+
+    std::size_t droppedCount() const { return m_droppedCount.load(std::memory_order_relaxed); }
+    std::size_t drainCount() const { return m_drainCount.load(std::memory_order_relaxed); }
+
+  private:
+    void schedule();
+    void drain();
+    void finishDrain();
+
+  private:
+    TA_BoundedQueue<Message> m_messages;
+    const TA_MailboxOverflow m_overflow;
+    const std::size_t m_quantum;
+    std::atomic_size_t m_thread{0};
+    std::atomic_bool m_scheduled{false};
+    std::atomic_bool m_closed{false};
+    std::atomic_size_t m_droppedCount{0};
+    std::atomic_size_t m_drainCount{0};
+};
+} // namespace CoreAsync
+
+#endif // TA_MAILBOX_H
@@ -20,10 +20,9 @@
 namespace CoreAsync {
 TA_CoroutineGenerator<TA_DefaultVariant, CoreAsync::Lazy> runningGenerator(TA_ManualChainPipeline *pPipeline) {
     for (auto i = pPipeline->startIndex(); i < pPipeline->m_pActivityList.size(); ++i) {
-        decltype(auto) pActivity{TA_CommonTools::at<std::shared_ptr<TA_ActivityProxy>>(pPipeline->m_pActivityList, i)};
-        (*pActivity)();
-        auto var{pActivity->result()};
-        TA_CommonTools::replace(pPipeline->m_resultList, i, var);
+        auto var{pPipeline->runStageToCompletion(i)};
+        pPipeline->m_resultList[i] = var;
+        pPipeline->checkpoint(i + 1);
         TA_Connection::active(pPipeline, &TA_ManualChainPipeline::activityCompleted, i, var);
         co_yield var;
     }
@@ -57,6 +56,7 @@ void TA_ManualChainPipeline::reset() {
     m_resultList.clear();
     m_resultList.resize(m_pActivityList.size());
     m_runningGenerator = runningGenerator(this);
+    m_sinceCheckpoint = 0;
     m_mutex.unlock();
     setState(State::Waiting);
     setStartIndex(0);
@@ -72,8 +72,68 @@ void TA_ManualChainPipeline::clear() {
     m_pActivityList.clear();
     m_resultList.clear();
     m_runningGenerator = runningGenerator(this);
+    m_sinceCheckpoint = 0;
     m_mutex.unlock();
     setState(State::Waiting);
     setStartIndex(0);
 }
+
+void TA_ManualChainPipeline::resetConfiguration() {
+    m_checkpointPath.clear();
+    m_checkpointInterval = 1;
+    m_sinceCheckpoint = 0;
+}
+
+void TA_ManualChainPipeline::setCheckpoint(const std::string &path, unsigned int interval) {
+    if (state() == State::Busy) {
+        assert(state() != State::Busy);
+        TA_CommonTools::debugInfo(META_STRING("Set checkpoint failed!"));
+        return;
+    }
+    m_checkpointPath = path;
+    m_checkpointInterval = std::max(interval, 1u);
+    m_sinceCheckpoint = 0;
+}
+
+bool TA_ManualChainPipeline::resume(const std::string &path) {
+    if (state() != State::Waiting) {
+        assert(state() == State::Waiting);
+        TA_CommonTools::debugInfo(META_STRING("Resume pipeline failed!"));
+        return false;
+    }
+    TA_PipelineCheckpoint::Snapshot snapshot;
+    if (!TA_PipelineCheckpoint::load(path, snapshot)) {
+        return false;
+    }
+    std::lock_guard<std::recursive_mutex> locker(m_mutex);
+    if (snapshot.activitySize != m_pActivityList.size() || snapshot.startIndex > snapshot.activitySize) {
+        TA_CommonTools::debugInfo(META_STRING("Checkpoint doesn't match the pipeline!"));
+        return false;
+    }
+    restore(snapshot);
+    return true;
+}
+
+void TA_ManualChainPipeline::checkpoint(ActivityIndex next) {
+    if (m_checkpointPath.empty() || (++m_sinceCheckpoint < m_checkpointInterval && next < m_pActivityList.size())) {
+        return;
+    }
+    m_sinceCheckpoint = 0;
+    TA_PipelineCheckpoint::Snapshot snapshot;
+    {
+        std::lock_guard<std::recursive_mutex> locker(m_mutex);
+        snapshot.activitySize = m_pActivityList.size();
+        snapshot.startIndex = next;
+        snapshot.position = checkpointPosition();
+        snapshot.results = m_resultList;
+    }
+    TA_PipelineCheckpoint::save(m_checkpointPath, snapshot);
+}
+
+void TA_ManualChainPipeline::restore(const TA_PipelineCheckpoint::Snapshot &snapshot) {
+    m_resultList = snapshot.results;
+    m_runningGenerator = runningGenerator(this);
+    m_sinceCheckpoint = 0;
+    setStartIndex(static_cast<ActivityIndex>(snapshot.startIndex));
+}
 } // namespace CoreAsync
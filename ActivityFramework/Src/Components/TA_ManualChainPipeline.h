@@ -18,9 +18,17 @@
 #define TA_MANUALCHAINPIPELINE_H
 
 #include "TA_BasicPipeline.h"
+#include "TA_PipelineCheckpoint.h"
 
 namespace CoreAsync {
 class TA_ManualChainPipeline : public TA_BasicPipeline {
+    friend TA_CoroutineGenerator<TA_DefaultVariant, CoreAsync::Lazy>
+    runningGenerator(TA_ManualChainPipeline *pPipeline);
+    friend TA_CoroutineGenerator<TA_DefaultVariant, CoreAsync::Lazy>
+    runningGenerator(TA_ManualStepsChainPipeline *pPipeline);
+    friend TA_CoroutineGenerator<TA_DefaultVariant, CoreAsync::Lazy>
+    runningGenerator(TA_ManualKeyActivityChainPipeline *pPipeline);
+
   public:
     ACTIVITY_FRAMEWORK_EXPORT TA_ManualChainPipeline();
     virtual ~TA_ManualChainPipeline() {}
@@ -35,11 +43,29 @@ class TA_ManualChainPipeline : public TA_BasicPipeline {
 
     void setStartIndex(ActivityIndex index) override;
 
+    // Writes the results, the next activity to run and the pipeline specific position to path after every interval
+    // completed activities and after the last one. An empty path turns checkpointing off.
+    void ACTIVITY_FRAMEWORK_EXPORT setCheckpoint(const std::string &path, unsigned int interval = 1);
+    // Restores a checkpoint written by a pipeline holding the same activities, the next execution continues after the
+    // last checkpointed activity.
+    bool ACTIVITY_FRAMEWORK_EXPORT resume(const std::string &path);
+
   protected:
     virtual void run() override;
 
+    void resetConfiguration() override;
+
+    void checkpoint(ActivityIndex next);
+    virtual std::int64_t checkpointPosition() const { return 0; }
+    virtual void restore(const TA_PipelineCheckpoint::Snapshot &snapshot);
+
   protected:
     TA_CoroutineGenerator<TA_DefaultVariant, CoreAsync::Lazy> m_runningGenerator;
+
+  private:
+    std::string m_checkpointPath;
+    unsigned int m_checkpointInterval{1};
+    unsigned int m_sinceCheckpoint{0};
 };
 
 namespace Reflex {
@@ -51,6 +77,8 @@ struct ACTIVITY_FRAMEWORK_EXPORT
         TA_MetaField{&Raw::clear, META_STRING("clear")},
         TA_MetaField{&Raw::reset, META_STRING("reset")},
         TA_MetaField{&Raw::setStartIndex, META_STRING("setStartIndex")},
+        TA_MetaField{&Raw::setCheckpoint, META_STRING("setCheckpoint")},
+        TA_MetaField{&Raw::resume, META_STRING("resume")},
     };
 };
 } // namespace Reflex
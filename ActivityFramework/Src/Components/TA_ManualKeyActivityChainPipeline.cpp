@@ -22,11 +22,11 @@ TA_CoroutineGenerator<TA_DefaultVariant, CoreAsync::Lazy>
 runningGenerator(TA_ManualKeyActivityChainPipeline *pPipeline) {
     bool isAtKey{false};
     for (auto i = pPipeline->startIndex(); i < pPipeline->m_pActivityList.size();) {
-        decltype(auto) pActivity{TA_CommonTools::at<std::shared_ptr<TA_ActivityProxy>>(pPipeline->m_pActivityList, i)};
-        if (!pActivity->isExecuted()) {
-            (*pActivity)();
-            auto var{pActivity->result()};
-            TA_CommonTools::replace(pPipeline->m_resultList, i, var);
+        decltype(auto) pActivity{pPipeline->m_pActivityList[i]};
+        if (!pActivity->isExecuted() && static_cast<int>(i) != pPipeline->m_restoredKey) {
+            auto var{pPipeline->runStageToCompletion(i)};
+            pPipeline->m_resultList[i] = var;
+            pPipeline->checkpoint(static_cast<int>(i) == pPipeline->keyIndex() ? i : i + 1);
             TA_Connection::active(pPipeline, &TA_ManualKeyActivityChainPipeline::activityCompleted, i, var);
             co_yield var;
         } else {
@@ -81,6 +81,7 @@ void TA_ManualKeyActivityChainPipeline::reset() {
     m_resultList.resize(m_pActivityList.size());
     m_mutex.unlock();
     m_keyIndex.store(-1, std::memory_order_release);
+    m_restoredKey = -1;
     m_runningGenerator = runningGenerator(this);
     setState(State::Waiting);
     setStartIndex(0);
@@ -100,5 +101,15 @@ void TA_ManualKeyActivityChainPipeline::clear() {
     setState(State::Waiting);
     setStartIndex(0);
     m_keyIndex.store(-1, std::memory_order_release);
+    m_restoredKey = -1;
+}
+
+void TA_ManualKeyActivityChainPipeline::restore(const TA_PipelineCheckpoint::Snapshot &snapshot) {
+    TA_ManualChainPipeline::restore(snapshot);
+    m_keyIndex.store(static_cast<int>(snapshot.position), std::memory_order_release);
+    m_restoredKey = snapshot.position >= 0 && snapshot.startIndex == static_cast<std::uint64_t>(snapshot.position)
+                        ? static_cast<int>(snapshot.position)
+                        : -1;
+    m_runningGenerator = runningGenerator(this);
 }
 } // namespace CoreAsync
@@ -21,6 +21,9 @@
 
 namespace CoreAsync {
 class TA_ManualKeyActivityChainPipeline : public TA_ManualChainPipeline {
+    friend TA_CoroutineGenerator<TA_DefaultVariant, CoreAsync::Lazy>
+    runningGenerator(TA_ManualKeyActivityChainPipeline *pPipeline);
+
   public:
     ACTIVITY_FRAMEWORK_EXPORT TA_ManualKeyActivityChainPipeline();
     virtual ~TA_ManualKeyActivityChainPipeline() {}
@@ -38,8 +41,13 @@ class TA_ManualKeyActivityChainPipeline : public TA_ManualChainPipeline {
   protected:
     virtual void run() override final;
 
+    std::int64_t checkpointPosition() const override final { return keyIndex(); }
+    void restore(const TA_PipelineCheckpoint::Snapshot &snapshot) override final;
+
   private:
     std::atomic<int> m_keyIndex{-1};
+    // A key activity restored from a checkpoint has its result but a fresh proxy, it must not be executed again.
+    int m_restoredKey{-1};
 };
 
 namespace Reflex {
@@ -22,10 +22,9 @@ TA_CoroutineGenerator<TA_DefaultVariant, CoreAsync::Lazy> runningGenerator(TA_Ma
     auto step{pPipeline->steps()};
     if (step <= pPipeline->m_pActivityList.size()) {
         for (auto i = pPipeline->startIndex(); i < pPipeline->m_pActivityList.size(); ++i) {
-            decltype(auto) pActivity{TA_CommonTools::at<std::shared_ptr<TA_ActivityProxy>>(pPipeline->m_pActivityList, i)};
-            (*pActivity)();
-            auto var{pActivity->result()};
-            TA_CommonTools::replace(pPipeline->m_resultList, i, var);
+            auto var{pPipeline->runStageToCompletion(i)};
+            pPipeline->m_resultList[i] = var;
+            pPipeline->checkpoint(i + 1);
             TA_Connection::active(pPipeline, &TA_ManualStepsChainPipeline::activityCompleted, i, var);
             if (--step == 0) {
                 co_yield var;
@@ -91,4 +90,12 @@ void TA_ManualStepsChainPipeline::setSteps(unsigned int steps) {
     }
     m_steps.store(steps, std::memory_order_release);
 }
+
+void TA_ManualStepsChainPipeline::restore(const TA_PipelineCheckpoint::Snapshot &snapshot) {
+    TA_ManualChainPipeline::restore(snapshot);
+    if (snapshot.position > 0) {
+        m_steps.store(static_cast<unsigned int>(snapshot.position), std::memory_order_release);
+    }
+    m_runningGenerator = runningGenerator(this);
+}
 } // namespace CoreAsync
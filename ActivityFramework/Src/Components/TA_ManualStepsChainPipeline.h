@@ -37,6 +37,9 @@ class TA_ManualStepsChainPipeline : public TA_ManualChainPipeline {
 
   protected:
     virtual void run() override final;
+
+    std::int64_t checkpointPosition() const override final { return steps(); }
+    void restore(const TA_PipelineCheckpoint::Snapshot &snapshot) override final;
     // TA_CoroutineGenerator<TA_DefaultVariant, CoreAsync::Lazy> runningGenerator(TA_ManualStepsChainPipeline
     // *pPipeline);
 
@@ -17,12 +17,23 @@
 #ifndef TA_METAOBJECT_H
 #define TA_METAOBJECT_H
 
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
 #include <string_view>
 #include <thread>
+#include <utility>
 #include <unordered_map>
+#include <unordered_set>
+#include <ranges>
 #include <any>
 #include <functional>
+#include <limits>
+#include <mutex>
+#include <vector>
 
+#include "TA_EpochDomain.h"
+#include "TA_Mailbox.h"
 #include "TA_ThreadPool.h"
 #include "TA_MetaReflex.h"
 #include "TA_Activity.h"
@@ -49,11 +60,57 @@ template <typename T> struct TA_MetaObjectTraits {
 template <typename T>
 concept EnableMetaObjectType = TA_MetaObjectTraits<T>::isMetaObject;
 
-enum class TA_ConnectionType { Auto, Direct, Queued };
+// Conflated connections are queued, but keep only the newest pending arguments and have at most one delivery in
+// flight, which is meant for high-frequency signals whose receivers only care about the latest value.
+enum class TA_ConnectionType { Auto, Direct, Queued, Conflated };
 
 class TA_MetaObject : public std::enable_shared_from_this<TA_MetaObject> {
     class TA_ConnectionObject;
     using AsyncTaskRes = TA_ManualCoroutineTask<std::shared_ptr<TA_DefaultVariant>, CorotuineBehavior::Eager>;
+    using SignalIndex = std::size_t;
+    // Argument tuple of one emission. It is built once and shared by every slot call the emission causes.
+    using SignalPayload = std::shared_ptr<std::any>;
+
+    // Slots taking references read the payload, whose tuple holds the plain argument types.
+    template <typename Tuple> struct PayloadTuple;
+    template <typename... Paras> struct PayloadTuple<std::tuple<Paras...>> {
+        using type = std::tuple<std::remove_cvref_t<Paras>...>;
+    };
+    using ConnectionList = std::vector<std::shared_ptr<TA_ConnectionObject>>;
+
+    // Immutable once published, edits copy it and swap the pointer. The lists are sorted by signal index and only
+    // signals with connections have one.
+    struct ConnectionTable {
+        using Entry = std::pair<SignalIndex, std::shared_ptr<const ConnectionList>>;
+        std::vector<Entry> lists;
+
+        auto find(SignalIndex index) { return std::ranges::lower_bound(lists, index, {}, &Entry::first); }
+        auto find(SignalIndex index) const { return std::ranges::lower_bound(lists, index, {}, &Entry::first); }
+    };
+
+    // Index of a signal in the connection tables, the same for every type the signal is named through. A sender
+    // derived from several bases is addressed through each base's static type, so the index can't be the position in
+    // the sender's field list. It is the position in the field list of the class declaring the signal, offset by a
+    // range that class gets on first use. Signals that are not reflected share index 0. The signal is a runtime value,
+    // so the position is found by comparing it with the fields of the same member pointer type.
+    template <typename Sender, typename Signal> static SignalIndex indexOfSignal(Signal &&signal) {
+        using Owner = typename MethodTypeInfo<std::decay_t<Signal>>::ParentClass;
+        if constexpr (requires { Reflex::TA_TypeInfo<Owner>::size(); }) {
+            if (std::size_t index{Reflex::TA_TypeInfo<Owner>::findIndex(signal)}; index != 0) {
+                return signalRange<Owner>() + index - 1;
+            }
+        }
+        // Registered only by a derived type, which is then the only type it can be named through.
+        std::size_t index{Reflex::TA_TypeInfo<std::decay_t<Sender>>::findIndex(signal)};
+        return index == 0 ? 0 : signalRange<std::decay_t<Sender>>() + index - 1;
+    }
+
+    template <typename Owner> static SignalIndex signalRange() {
+        static const SignalIndex first{
+            m_signalCount.fetch_add(Reflex::TA_TypeInfo<Owner>::size(), std::memory_order_relaxed)};
+        return first;
+    }
+
   public:
     class TA_ConnectionObjectHolder {
         friend class TA_MetaObject;
@@ -80,21 +137,26 @@ class TA_MetaObject : public std::enable_shared_from_this<TA_MetaObject> {
     TA_MetaObject() : m_sourceThread(std::this_thread::get_id()),
                       m_affinityThreadIdx(TA_ThreadHolder::get().topPriorityThread()) {}
 
-    virtual ~TA_MetaObject() { destroyConnections(); }
+    virtual ~TA_MetaObject() {
+        if (auto *pMailbox = mailbox()) {
+            pMailbox->close();
+        }
+        destroyConnections();
+    }
 
     TA_MetaObject(const TA_MetaObject &object)
         : m_sourceThread(std::this_thread::get_id()), m_affinityThreadIdx(TA_ThreadHolder::get().topPriorityThread()),
-          m_outputConnections(object.m_outputConnections), m_inputConnections(object.m_inputConnections) {}
+          m_pConnectionTable(object.copyConnectionTable()), m_inputConnections(object.copyInputConnections()) {}
 
     TA_MetaObject(TA_MetaObject &&object) noexcept
         : m_sourceThread(std::this_thread::get_id()), m_affinityThreadIdx(TA_ThreadHolder::get().topPriorityThread()),
-          m_outputConnections(std::move(object.m_outputConnections)),
-          m_inputConnections(std::move(object.m_inputConnections)) {}
+          m_pConnectionTable(object.takeConnectionTable()),
+          m_inputConnections(object.takeInputConnections()) {}
 
     TA_MetaObject &operator=(const TA_MetaObject &object) {
         if (this != &object) {
-            m_outputConnections = object.m_outputConnections;
-            m_inputConnections = object.m_inputConnections;
+            publishConnectionTable(object.copyConnectionTable());
+            resetInputConnections(object.copyInputConnections());
             m_affinityThreadIdx.store(object.affinityThread(), std::memory_order_release);
         }
         return *this;
@@ -102,8 +164,8 @@ class TA_MetaObject : public std::enable_shared_from_this<TA_MetaObject> {
 
     TA_MetaObject &operator=(TA_MetaObject &&object) noexcept {
         if (this != &object) {
-            m_outputConnections = std::move(object.m_outputConnections);
-            m_inputConnections = std::move(object.m_inputConnections);
+            publishConnectionTable(object.takeConnectionTable());
+            resetInputConnections(object.takeInputConnections());
             m_affinityThreadIdx.store(std::move(object.affinityThread()), std::memory_order_release);
         }
         return *this;
@@ -112,8 +174,10 @@ class TA_MetaObject : public std::enable_shared_from_this<TA_MetaObject> {
     template <EnableMetaObjectType Object>
     static auto sharedRef(Object *pObject) -> std::shared_ptr<std::remove_cvref_t<Object>> {
         auto weakRef = pObject->weak_from_this();
+        // Objects that no shared_ptr owns get an aliasing handle without a control block. Wrapping them in an owning
+        // shared_ptr would hand them a weak_this that expires with the handle.
         if(weakRef.expired())
-            return std::shared_ptr<std::remove_cvref_t<Object>>(pObject, [](TA_MetaObject *){});
+            return std::shared_ptr<std::remove_cvref_t<Object>>(std::shared_ptr<void>{}, pObject);
         return std::dynamic_pointer_cast<std::remove_cvref_t<Object>>(weakRef.lock());
     }
 
@@ -134,28 +198,50 @@ class TA_MetaObject : public std::enable_shared_from_this<TA_MetaObject> {
         return m_pendingCounter.isIdle() && !m_isBeingDestroyed.load(std::memory_order_acquire);
     }
 
+    // Queued slot calls to the object that have not returned yet.
+    bool hasQueuedCalls() const {
+        return !m_pQueuedCalls->isIdle();
+    }
+
     void resetPendingCount() {
         m_pendingCounter.reset();
     }
 
     bool isBeingDestroyed() const {
-        return m_isBeingDestroyed.load(std::memory_order_acquire);
+        return m_isBeingDestroyed.load(std::memory_order_seq_cst);
     }
 
   protected:
     struct PendingCounter {
+        // Set on the queued call count while tryMoveToThread() changes the affinity thread.
+        static constexpr std::size_t movingFlag{std::size_t{1} << (std::numeric_limits<std::size_t>::digits - 1)};
+
         std::atomic_size_t m_counter{0};
         void reset() {
             m_counter.store(0, std::memory_order_release);
         }
+        // Sequentially consistent, an increment racing with deleteLater() either sees the object being destroyed or
+        // keeps it from being reclaimed. An increment that lands in a move waits it out, so the affinity thread read
+        // afterwards is the new one.
         void increment() {
-            m_counter.fetch_add(1, std::memory_order_acquire);
+            if (m_counter.fetch_add(1, std::memory_order_seq_cst) & movingFlag) {
+                while (m_counter.load(std::memory_order_acquire) & movingFlag) {
+                    std::this_thread::yield();
+                }
+            }
         }
         void decrement() {
-            m_counter.fetch_sub(1, std::memory_order_acquire);
+            m_counter.fetch_sub(1, std::memory_order_acq_rel);
         }
         bool isIdle() const {
-            return m_counter.load(std::memory_order_acquire) == 0;
+            return m_counter.load(std::memory_order_seq_cst) == 0;
+        }
+        // Fails if anything but the given number of pending calls is in flight.
+        bool beginMove(std::size_t pending) {
+            return m_counter.compare_exchange_strong(pending, pending | movingFlag, std::memory_order_seq_cst);
+        }
+        void endMove() {
+            m_counter.fetch_and(~movingFlag, std::memory_order_release);
         }
         auto operator ++ () -> PendingCounter & {
             increment();
@@ -183,12 +269,14 @@ class TA_MetaObject : public std::enable_shared_from_this<TA_MetaObject> {
         if (!pHost) {
             throw std::invalid_argument("Host object is null");
         }
+        pHost->pendingCountIncrement();
         if (pHost->isBeingDestroyed()) {
+            pHost->pendingCountDecrement();
             throw std::runtime_error("Host object is being destroyed.");
         }
-        pHost->pendingCountIncrement();
         std::size_t idx = pHost->affinityThread();
         if (idx >= TA_ThreadHolder::get().size()) {
+            pHost->pendingCountDecrement();
             throw std::out_of_range("Thread index out of range.");
         }
         if (pHost->isIdle()) {
@@ -211,12 +299,14 @@ class TA_MetaObject : public std::enable_shared_from_this<TA_MetaObject> {
         if (!pHost) {
             throw std::invalid_argument("Host object is null");
         }
+        pHost->pendingCountIncrement();
         if (pHost->isBeingDestroyed()) {
+            pHost->pendingCountDecrement();
             throw std::runtime_error("Host object is being destroyed.");
         }
-        pHost->pendingCountIncrement();
         std::size_t idx = pHost->affinityThread();
         if (idx >= TA_ThreadHolder::get().size()) {
+            pHost->pendingCountDecrement();
             throw std::out_of_range("Thread index out of range.");
         }
         if (pHost->isIdle()) {
@@ -286,14 +376,27 @@ class TA_MetaObject : public std::enable_shared_from_this<TA_MetaObject> {
             TA_ActivityCreator::create(Method{}, std::forward<Args>(args)...), true);
     }
 
+    // The object is cut off from all its connections right away and retired to the epoch domain. It is destroyed by
+    // whichever thread reclaims it, once no slot call that reached it is still running and no awaited activity hosted
+    // by it is pending. Other activities holding a plain pointer to it are not waited for.
     bool deleteLater() {
         if(hasSharedRef())
             return false;
-        m_isBeingDestroyed.store(true, std::memory_order_release);
-        auto activity = TA_ActivityCreator::create([this]() -> void {
-            delete this;
-        });
-        activity->setStolenEnabled(false);
+        if (m_isBeingDestroyed.exchange(true, std::memory_order_seq_cst))
+            return false;
+        if (auto *pMailbox = mailbox()) {
+            pMailbox->close();
+        }
+        destroyConnections();
+        {
+            // Keeps the calling thread from reclaiming the object before deleteLater has returned.
+            auto guard = TA_EpochDomain::get().pin();
+            TA_EpochDomain::get().retire(
+                static_cast<void *>(this), [](void *pObject) { delete static_cast<TA_MetaObject *>(pObject); },
+                [](void *pObject) { return static_cast<TA_MetaObject *>(pObject)->m_pendingCounter.isIdle(); });
+        }
+        // Workers reclaim on their way to idle, this makes sure one of them gets there.
+        auto activity = TA_ActivityCreator::create([]() -> void { TA_EpochDomain::get().reclaim(); });
         activity->moveToThread(this->affinityThread());
         auto fetcher = TA_ThreadHolder::get().postActivity(activity, true);
         return true;
@@ -301,6 +404,41 @@ class TA_MetaObject : public std::enable_shared_from_this<TA_MetaObject> {
 
     std::size_t affinityThread() const { return m_affinityThreadIdx.load(std::memory_order_acquire); }
 
+    // Opt-in actor mode: queued slot calls to this object go through a bounded mailbox instead of one activity per
+    // emission, see TA_Mailbox. The mailbox can't be replaced once enabled.
+    bool enableMailbox(std::size_t capacity = 1024, TA_MailboxOverflow overflow = TA_MailboxOverflow::DropNewest,
+                       std::size_t quantum = 64) {
+        std::lock_guard<std::mutex> locker(m_connectionMutex);
+        if (m_pMailboxOwner) {
+            return false;
+        }
+        m_pMailboxOwner = std::make_shared<TA_Mailbox>(capacity, overflow, quantum);
+        m_pMailbox.store(m_pMailboxOwner.get(), std::memory_order_release);
+        return true;
+    }
+
+    TA_Mailbox *mailbox() const { return m_pMailbox.load(std::memory_order_acquire); }
+
+    // Time spent in the object's slots and number of slot calls, only collected while TA_Rebalancer tracks it.
+    struct SlotLoad {
+        std::chrono::nanoseconds busyTime{0};
+        std::uint64_t messages{0};
+    };
+
+    bool isSlotLoadSampled() const { return m_slotLoadSampled.load(std::memory_order_relaxed); }
+    void setSlotLoadSampled(bool sampled) { m_slotLoadSampled.store(sampled, std::memory_order_relaxed); }
+
+    void recordSlotLoad(std::chrono::nanoseconds busyTime) {
+        m_slotBusyNanos.fetch_add(busyTime.count(), std::memory_order_relaxed);
+        m_slotMessages.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Returns the load collected since the previous call.
+    SlotLoad takeSlotLoad() {
+        return {std::chrono::nanoseconds{m_slotBusyNanos.exchange(0, std::memory_order_relaxed)},
+                m_slotMessages.exchange(0, std::memory_order_relaxed)};
+    }
+
     bool moveToThread(std::size_t idx) {
         if (m_affinityThreadIdx.load(std::memory_order_acquire) == idx) {
             return false;
@@ -316,6 +454,32 @@ class TA_MetaObject : public std::enable_shared_from_this<TA_MetaObject> {
         return taskResult->template get<bool>();
     }
 
+    // Moves the object like moveToThread(), but only while none of its queued slot calls is in flight, so calls that
+    // were queued on the old thread can't overlap with the ones queued on the new thread. Mailbox deliveries don't
+    // count, the mailbox runs them one at a time wherever they are posted.
+    bool tryMoveToThread(std::size_t idx) {
+        if (m_affinityThreadIdx.load(std::memory_order_acquire) == idx || idx >= TA_ThreadHolder::get().size()) {
+            return false;
+        }
+        auto move = [this, idx]() -> bool {
+            if (!m_pQueuedCalls->beginMove(0)) {
+                return false;
+            }
+            m_affinityThreadIdx.store(idx, std::memory_order_release);
+            m_pQueuedCalls->endMove();
+            return true;
+        };
+        if (isOnCurrentThread(this)) {
+            return move();
+        }
+        // Runs behind whatever the old thread already has for the object.
+        auto activity = TA_ActivityCreator::create(std::move(move));
+        activity->setStolenEnabled(false);
+        AsyncTaskRes res = invokeActivity(activity, this);
+        auto taskResult = res.get();
+        return taskResult->template get<bool>();
+    }
+
     template <EnableConnectObjectType Sender, typename Signal, EnableConnectObjectType Receiver, typename Slot>
     static constexpr bool registerConnection(Sender *pSender, Signal &&signal, Receiver *pReceiver, Slot &&slot,
                                              TA_ConnectionType type) {
@@ -365,19 +529,61 @@ class TA_MetaObject : public std::enable_shared_from_this<TA_MetaObject> {
         }
 
         auto sharedSender = sharedRef(pSender);
-        if(isOnCurrentThread(pSender)) {
-            return m_registerLambdaConnectionImpl<std::shared_ptr<Sender>, Signal, LambdaExp>(
-                sharedSender, std::forward<Signal>(signal), std::forward<LambdaExp>(exp), type, autoDestroy);
-        }
-        using ExpType = decltype(m_registerLambdaConnectionImpl<std::shared_ptr<Sender>, Signal, LambdaExp>);
-        auto registerActivity = TA_ActivityCreator::create(
-            std::forward<ExpType>(m_registerLambdaConnectionImpl<std::shared_ptr<Sender>, Signal, LambdaExp>),
+        return m_registerLambdaConnectionImpl<std::shared_ptr<Sender>, Signal, LambdaExp>(
             sharedSender, std::forward<Signal>(signal), std::forward<LambdaExp>(exp), type, autoDestroy);
-        registerActivity->moveToThread(pSender->affinityThread());
-        registerActivity->setStolenEnabled(false);
-        AsyncTaskRes res = invokeActivity(registerActivity, pSender);
-        auto taskResult = res.get();
-        return taskResult->template get<TA_ConnectionObjectHolder>();
+    }
+
+    // Connects one signal to the same slot of many receivers. The sender's connection list is copied and published
+    // once for the whole range instead of once per receiver. Returns the number of connections that were added.
+    template <EnableConnectObjectType Sender, typename Signal, std::ranges::input_range Receivers, typename Slot>
+    static std::size_t registerConnections(Sender *pSender, Signal &&signal, Receivers &&receivers, Slot &&slot,
+                                           TA_ConnectionType type) {
+        using Receiver = std::remove_pointer_t<std::ranges::range_value_t<Receivers>>;
+        static_assert(EnableConnectObjectType<Receiver>, "The receivers must be meta objects.");
+        if constexpr (!Reflex::TA_MemberTypeTrait<Signal>::instanceMethodFlag ||
+                      !Reflex::TA_MemberTypeTrait<Slot>::instanceMethodFlag ||
+                      !IsReturnTypeEqual<void, Signal, std::is_same>::value ||
+                      !IsReturnTypeEqual<void, Slot, std::is_same>::value) {
+            return 0;
+        }
+        if constexpr (MethodTypeInfo<Signal>::argSize != MethodTypeInfo<Slot>::argSize) {
+            return 0;
+        }
+        if constexpr (MethodTypeInfo<Signal>::argSize != 0 && MethodTypeInfo<Slot>::argSize != 0) {
+            if constexpr (!MetaSame<typename MethodTypeInfo<Signal>::ArgGroup,
+                                    typename MethodTypeInfo<Slot>::ArgGroup>::value) {
+                return 0;
+            }
+        }
+        if (!pSender) {
+            return 0;
+        }
+        auto sharedSender = sharedRef(pSender);
+        SignalIndex signalIndex{indexOfSignal<Sender>(std::forward<Signal>(signal))};
+        TA_ConnectionObject::FuncMark slotMark{Reflex::TA_TypeInfo<std::decay_t<Receiver>>::findName(slot)};
+        std::vector<std::pair<Receiver *, std::shared_ptr<TA_ConnectionObject>>> added;
+        sharedSender->editConnections(signalIndex, [&](ConnectionList &connections) {
+            std::unordered_set<const TA_MetaObject *> connected;
+            for (auto &obj : connections) {
+                if (obj->slotMark() == slotMark) {
+                    connected.emplace(obj->receiver());
+                }
+            }
+            for (Receiver *pReceiver : receivers) {
+                if (!pReceiver || !connected.emplace(pReceiver).second) {
+                    continue;
+                }
+                auto conn = std::make_shared<TA_ConnectionObject>(pSender, std::decay_t<Signal>{signal}, type);
+                conn->initSlotObject(pReceiver, std::decay_t<Slot>{slot});
+                connections.emplace_back(conn);
+                added.emplace_back(pReceiver, std::move(conn));
+            }
+            return !added.empty();
+        });
+        for (auto &&[pReceiver, conn] : added) {
+            pReceiver->addInputConnection(slotMark, std::move(conn));
+        }
+        return added.size();
     }
 
     template <EnableConnectObjectType Sender, typename Signal, EnableConnectObjectType Receiver, typename Slot>
@@ -401,12 +607,11 @@ class TA_MetaObject : public std::enable_shared_from_this<TA_MetaObject> {
         }
         auto sharedSender = sharedRef(pSender);
         auto sharedReceiver = sharedRef(pReceiver);
-        TA_ConnectionObject::FuncMark signalMark{
-            Reflex::TA_TypeInfo<std::decay_t<Sender>>::findName(std::forward<Signal>(signal))};
+        SignalIndex signalIndex{indexOfSignal<Sender>(std::forward<Signal>(signal))};
         TA_ConnectionObject::FuncMark slotMark{
             Reflex::TA_TypeInfo<std::decay_t<Receiver>>::findName(std::forward<Slot>(slot))};
         return m_unregisterConnectionImpl<std::shared_ptr<Sender>, std::shared_ptr<Receiver>>(
-            sharedSender, std::forward<TA_ConnectionObject::FuncMark>(signalMark),
+            sharedSender, std::move(signalIndex),
             sharedReceiver, std::forward<TA_ConnectionObject::FuncMark>(slotMark));
     }
 
@@ -414,17 +619,7 @@ class TA_MetaObject : public std::enable_shared_from_this<TA_MetaObject> {
         if (!holder.valid() || !holder.m_pConnection) {
             return false;
         }
-        auto *pSender = holder.m_pConnection->sender();
-        if(isOnCurrentThread(pSender)) {
-            return m_unregisterConnectionHolderImpl<TA_MetaObject>(holder);
-        }
-        using ExpType = decltype(m_unregisterConnectionHolderImpl<TA_MetaObject>);
-        auto activity = TA_ActivityCreator::create(
-            std::forward<ExpType>(m_unregisterConnectionHolderImpl<TA_MetaObject>), std::ref(holder));
-        activity->setStolenEnabled(false);
-        AsyncTaskRes res = invokeActivity(activity, pSender);
-        auto taskResult = res.get();
-        return taskResult->template get<bool>();
+        return m_unregisterConnectionHolderImpl<TA_MetaObject>(holder);
     }
 
     template <EnableConnectObjectType Sender, typename Signal, typename... ConnectionParameter>
@@ -441,26 +636,10 @@ class TA_MetaObject : public std::enable_shared_from_this<TA_MetaObject> {
         if (!pSender) {
             return false;
         }
-        if(isOnCurrentThread(pSender)) {
-            m_emitSignalImpl<Sender *, Signal, std::remove_cvref_t<ConnectionParameter>...>(pSender, std::forward<Signal>(signal), std::forward<ConnectionParameter>(args)...);
-        } else {
-            if(!pSender->hasSharedRef()) {
-                using RawPtrExpType = decltype(m_emitSignalImpl<Sender *, Signal, std::remove_cvref_t<ConnectionParameter>...>);
-                auto activity = TA_ActivityCreator::create(
-                    std::forward<RawPtrExpType>(m_emitSignalImpl<Sender *, Signal, std::remove_cvref_t<ConnectionParameter>...>),
-                    pSender, std::forward<Signal>(signal), std::forward<ConnectionParameter>(args)...);
-                activity->setStolenEnabled(false);
-                invokeActivityNoAwait(activity, pSender);
-            } else {
-                auto sharedSender = sharedRef(pSender);
-                using SharedExpType = decltype(m_emitSignalImpl<std::shared_ptr<Sender>, Signal, std::remove_cvref_t<ConnectionParameter>...>);
-                auto activity = TA_ActivityCreator::create(
-                    std::forward<SharedExpType>(m_emitSignalImpl<std::shared_ptr<Sender>, Signal, std::remove_cvref_t<ConnectionParameter>...>),
-                    std::move(sharedSender), std::forward<Signal>(signal), std::forward<ConnectionParameter>(args)...);
-                activity->setStolenEnabled(false);
-                invokeActivityNoAwait(activity, pSender);
-            }
-        }
+        // The connection lists are snapshots, so any thread reads them in place. Slots that can't run on the calling
+        // thread are posted straight to the thread of their receiver.
+        m_emitSignalImpl<Sender *, Signal, std::remove_cvref_t<ConnectionParameter>...>(
+            pSender, std::forward<Signal>(signal), std::forward<ConnectionParameter>(args)...);
         return true;
     }
 
@@ -484,36 +663,91 @@ class TA_MetaObject : public std::enable_shared_from_this<TA_MetaObject> {
             return false;
         }
 
-        TA_ConnectionObject::FuncMark signalMark{
-            Reflex::TA_TypeInfo<std::decay_t<Sender>>::findName(std::forward<Signal>(signal))};
+        SignalIndex signalIndex{indexOfSignal<Sender>(std::forward<Signal>(signal))};
         TA_ConnectionObject::FuncMark slotMark{
             Reflex::TA_TypeInfo<std::decay_t<Receiver>>::findName(std::forward<Slot>(slot))};
-        auto sharedSender = sharedRef(pSender);
-        auto sharedReceiver = sharedRef(pReceiver);
-        if(isOnCurrentThread(pSender)) {
-            return m_isConnectionExistedImpl<std::shared_ptr<Sender>, std::shared_ptr<Receiver>>(
-                sharedSender, std::forward<TA_ConnectionObject::FuncMark>(signalMark),
-                sharedReceiver, std::forward<TA_ConnectionObject::FuncMark>(slotMark));
+        auto guard = TA_EpochDomain::get().pin();
+        const ConnectionList *pConnections = pSender->connections(signalIndex);
+        if (!pConnections) {
+            return false;
         }
-        auto activity = TA_ActivityCreator::create(
-            m_isConnectionExistedImpl<std::shared_ptr<Sender>, std::shared_ptr<Receiver>>,
-            sharedSender, signalMark, sharedReceiver, slotMark);
-        activity->setStolenEnabled(false);
-        AsyncTaskRes res = invokeActivity(activity, pSender);
-        auto taskResult = res.get();
-        return taskResult->template get<bool>();
+        return std::any_of(pConnections->begin(), pConnections->end(), [pReceiver, &slotMark](auto &obj) {
+            return obj->receiver() == pReceiver && obj->slotMark() == slotMark;
+        });
     }
 
   private:
+    // Slot calls of one emission that can't run on the emitting thread. They are grouped by target thread, so each
+    // thread receives a single activity that runs its calls in connection order instead of one post per slot. A group
+    // holds one reference to the payload and hands it to its last call, so the refcount is touched once per thread.
+    // Only that last call may move the arguments out.
+    class TA_SlotBatch {
+      public:
+        using SlotExpType = std::function<void(const SignalPayload &, bool)>;
+
+        // The call was counted on its receiver by TA_ConnectionObject::beginQueuedCall(). It ends once its group has
+        // run, or was dropped.
+        void add(std::size_t thread, const SlotExpType &slotExp, const SignalPayload &pPayload,
+                 const std::shared_ptr<PendingCounter> &pQueuedCalls) {
+            auto iter = std::find_if(m_threadCalls.begin(), m_threadCalls.end(),
+                                     [thread](auto &threadCalls) { return threadCalls.thread == thread; });
+            if (iter == m_threadCalls.end()) {
+                iter = m_threadCalls.emplace(m_threadCalls.end(), thread, pPayload);
+            }
+            iter->slotExps.emplace_back(slotExp);
+            iter->queuedCalls.emplace_back(pQueuedCalls);
+        }
+
+        void post() {
+            for (auto &threadCalls : m_threadCalls) {
+                auto pCalls = std::make_shared<ThreadCalls>(std::move(threadCalls));
+                auto activity = TA_ActivityCreator::create([pCalls]() -> void {
+                    auto &slotExps = pCalls->slotExps;
+                    for (std::size_t idx = 0; idx + 1 < slotExps.size(); ++idx) {
+                        slotExps[idx](pCalls->pPayload, false);
+                    }
+                    slotExps.back()(SignalPayload{std::move(pCalls->pPayload)}, true);
+                    pCalls->endCalls();
+                });
+                activity->setStolenEnabled(false);
+                activity->moveToThread(pCalls->thread);
+                auto fetcher = TA_ThreadHolder::get().postActivity(activity, true);
+            }
+            m_threadCalls.clear();
+        }
+
+      private:
+        struct ThreadCalls {
+            ThreadCalls(std::size_t threadIdx, const SignalPayload &pArgs) : thread(threadIdx), pPayload(pArgs) {}
+            ThreadCalls(ThreadCalls &&calls) noexcept = default;
+            ThreadCalls &operator=(ThreadCalls &&calls) noexcept = default;
+            ~ThreadCalls() { endCalls(); }
+
+            void endCalls() {
+                for (auto &pQueuedCalls : queuedCalls) {
+                    pQueuedCalls->decrement();
+                }
+                queuedCalls.clear();
+            }
+
+            std::size_t thread;
+            SignalPayload pPayload;
+            std::vector<SlotExpType> slotExps;
+            std::vector<std::shared_ptr<PendingCounter>> queuedCalls;
+        };
+
+        std::vector<ThreadCalls> m_threadCalls;
+    };
+
     class TA_ConnectionObject : public std::enable_shared_from_this<TA_ConnectionObject> {
-        using SlotExpType = std::function<void()>;
+        using SlotExpType = TA_SlotBatch::SlotExpType;
       public:
         TA_ConnectionObject() = default;
         template <EnableConnectObjectType Sender, typename Signal>
         TA_ConnectionObject(Sender *pSender, Signal &&signal, TA_ConnectionType type)
             : m_pSender(pSender),
               m_senderFunc(Reflex::TA_TypeInfo<std::decay_t<Sender>>::findName(std::forward<Signal>(signal))),
-              m_type(type), m_autoDestroy(false) {
+              m_signalIndex(indexOfSignal<Sender>(std::forward<Signal>(signal))), m_type(type), m_autoDestroy(false) {
             if (pSender->hasSharedRef()) {
                 m_wpSender = pSender->weak_from_this();
             }
@@ -523,7 +757,8 @@ class TA_MetaObject : public std::enable_shared_from_this<TA_MetaObject> {
         TA_ConnectionObject(Sender *pSender, Signal &&signal, TA_ConnectionType type, bool autoDestroy)
             : m_pSender(pSender), m_pReceiver(pSender),
               m_senderFunc(Reflex::TA_TypeInfo<std::decay_t<Sender>>::findName(std::forward<Signal>(signal))),
-              m_type(type), m_autoDestroy(autoDestroy) {
+              m_signalIndex(indexOfSignal<Sender>(std::forward<Signal>(signal))), m_type(type),
+              m_autoDestroy(autoDestroy) {
             if (pSender->hasSharedRef()) {
                 m_wpSender = pSender->weak_from_this();
                 m_wpReceiver = pSender->weak_from_this();
@@ -547,17 +782,31 @@ class TA_MetaObject : public std::enable_shared_from_this<TA_MetaObject> {
             m_receiverFunc = Reflex::TA_TypeInfo<std::decay_t<Receiver>>::findName(std::forward<Slot>(slot));
             using SlotParaTuple = typename MethodTypeInfo<Slot>::ArgGroup::Tuple;
             using Ret = typename MethodTypeInfo<Slot>::RetType;
-            m_para = SlotParaTuple{};
             auto sharedRef = getSharedPtr();
-            m_slotExp = [sharedRef, slot]() -> void {
+            m_slotExp = [sharedRef, slot](const SignalPayload &pPayload, bool canMove) -> void {
+                // A queued call may run after the receiver was disconnected by deleteLater(). The pin keeps the
+                // receiver alive from the check until the slot returns.
+                auto guard = TA_EpochDomain::get().pin();
+                if (!sharedRef->isConnected()) {
+                    return;
+                }
                 auto *pRawReceiver = sharedRef->resolveReceiver();
                 if(!pRawReceiver) {
                     return;
                 }
                 decltype(auto) rObj{dynamic_cast<std::decay_t<Receiver> *>(pRawReceiver)};
-                if constexpr (IsInstanceMethod<Slot>::value)
-                    std::apply(slot, std::move(std::tuple_cat(std::make_tuple(rObj),
-                                                              std::any_cast<SlotParaTuple>(sharedRef->m_para))));
+                if constexpr (IsInstanceMethod<Slot>::value) {
+                    auto call = [rObj, &slot](auto &&...args) {
+                        std::invoke(slot, rObj, std::forward<decltype(args)>(args)...);
+                    };
+                    if (!pRawReceiver->isSlotLoadSampled()) {
+                        applyPayload<SlotParaTuple>(pPayload, canMove, call);
+                        return;
+                    }
+                    const auto begin = std::chrono::steady_clock::now();
+                    applyPayload<SlotParaTuple>(pPayload, canMove, call);
+                    pRawReceiver->recordSlotLoad(std::chrono::steady_clock::now() - begin);
+                }
             };
         }
 
@@ -566,35 +815,60 @@ class TA_MetaObject : public std::enable_shared_from_this<TA_MetaObject> {
             m_receiverFunc = typeid(LambdaExp).name();
             using SlotParaTuple = typename LambdaExpTraits<std::decay_t<LambdaExp>>::ArgGroup::Tuple;
             using Ret = typename LambdaExpTraits<std::decay_t<LambdaExp>>::RetType;
-            m_para = SlotParaTuple{};
-            auto sharedRef = getSharedPtr();
-            m_slotExp = [sharedRef, exp]() -> void {
-                std::apply(exp, std::any_cast<SlotParaTuple>(sharedRef->m_para));
+            m_slotExp = [exp](const SignalPayload &pPayload, bool canMove) -> void {
+                applyPayload<SlotParaTuple>(pPayload, canMove, exp);
             };
         }
 
+        // Slots read the arguments in place. A call may move them out, which saves the copy into by-value parameters,
+        // only when it is the last one its holder makes with the payload and every other holder has let it go. The
+        // flag carries the first condition, a holder can't tell from the refcount whether it still has calls to make.
+        template <typename SlotParaTuple, typename Fn>
+        static void applyPayload(const SignalPayload &pPayload, bool canMove, Fn &&fn) {
+            auto *pArgs = std::any_cast<typename PayloadTuple<SlotParaTuple>::type>(pPayload.get());
+            if (!pArgs) {
+                throw std::bad_any_cast();
+            }
+            if (canMove && pPayload.use_count() == 1) {
+                // Pairs with the release of the other holders when they dropped their references.
+                std::atomic_thread_fence(std::memory_order_acquire);
+                std::apply(std::forward<Fn>(fn), std::move(*pArgs));
+            } else {
+                std::apply(std::forward<Fn>(fn), std::as_const(*pArgs));
+            }
+        }
+
         std::shared_ptr<TA_ConnectionObject> getSharedPtr() { return this->shared_from_this(); }
         std::weak_ptr<TA_ConnectionObject> getWeakPtr() { return this->weak_from_this(); }
 
-        template <typename... Args> void setPara(Args &&...args) {
-            using ArgsTypes = std::tuple<std::decay_t<Args>...>;
-            if constexpr (sizeof...(Args) != 0)
-                m_para.emplace<ArgsTypes>(std::move(std::make_tuple(std::forward<Args>(args)...)));
-        }
-
-        void callSlot() {
-            auto slotExp = m_slotExp;
-            auto activity = TA_ActivityCreator::create(std::forward<SlotExpType>(slotExp));
-            activity->setStolenEnabled(false);
+        // The payload travels with the call, emissions from different threads may run the same connection at once.
+        // Calls that have to run on the receiver's thread are collected in the batch of the emission. The last
+        // connection of an emission takes over the emitter's reference.
+        void callSlot(TA_SlotBatch &batch, SignalPayload &pPayload, bool isLast) {
             auto *pRealSender = resolveSender();
             auto *pRealReceiver = resolveReceiver();
             if(pRealSender && pRealReceiver) {
-                activity->moveToThread(pRealReceiver->affinityThread());
-                if (pRealSender->affinityThread() == pRealReceiver->affinityThread() &&
-                    (m_type == TA_ConnectionType::Direct || m_type == TA_ConnectionType::Auto)) {
-                    activity->operator()();
+                // A one-shot connection fires once even if several threads emit at the same time.
+                if (m_autoDestroy && !m_connected.exchange(false, std::memory_order_acq_rel)) {
+                    return;
+                }
+                if (m_type == TA_ConnectionType::Conflated) {
+                    conflate(batch, pRealReceiver, pPayload);
+                } else if ((m_type == TA_ConnectionType::Direct || m_type == TA_ConnectionType::Auto) &&
+                           isOnCurrentThread(pRealReceiver)) {
+                    if (isLast) {
+                        m_slotExp(SignalPayload{std::move(pPayload)}, true);
+                    } else {
+                        m_slotExp(pPayload, false);
+                    }
+                } else if (auto *pMailbox = pRealReceiver->mailbox()) {
+                    pMailbox->post(
+                        [pConnection = getSharedPtr(), pPayload = isLast ? std::move(pPayload) : pPayload]() mutable {
+                            pConnection->m_slotExp(SignalPayload{std::move(pPayload)}, true);
+                        },
+                        pRealReceiver->affinityThread());
                 } else {
-                    auto fetcher = TA_ThreadHolder::get().postActivity(activity, true);
+                    batch.add(beginQueuedCall(pRealReceiver), m_slotExp, pPayload, pRealReceiver->m_pQueuedCalls);
                 }
             }
             if (m_autoDestroy) {
@@ -602,6 +876,39 @@ class TA_MetaObject : public std::enable_shared_from_this<TA_MetaObject> {
             }
         }
 
+        // Replaces the pending arguments and schedules a delivery unless one is already queued. The delivery drops its
+        // flag before it takes the arguments, so an emission racing with it either is picked up or schedules anew.
+        void conflate(TA_SlotBatch &batch, TA_MetaObject *pReceiver, const SignalPayload &pPayload) {
+            m_pPendingPayload.store(pPayload, std::memory_order_release);
+            if (m_deliveryScheduled.exchange(true, std::memory_order_acq_rel)) {
+                return;
+            }
+            auto deliver = [pConnection = getSharedPtr()]() -> void {
+                pConnection->m_deliveryScheduled.store(false, std::memory_order_release);
+                auto pPayload = pConnection->m_pPendingPayload.exchange(nullptr, std::memory_order_acq_rel);
+                if (pPayload) {
+                    pConnection->m_slotExp(pPayload, true);
+                }
+            };
+            if (auto *pMailbox = pReceiver->mailbox()) {
+                // A dropped delivery must not leave the connection waiting for it.
+                if (!pMailbox->post(std::move(deliver), pReceiver->affinityThread())) {
+                    m_deliveryScheduled.store(false, std::memory_order_release);
+                }
+                return;
+            }
+            batch.add(beginQueuedCall(pReceiver),
+                      [deliver = std::move(deliver)](const SignalPayload &, bool) -> void { deliver(); }, pPayload,
+                      pReceiver->m_pQueuedCalls);
+        }
+
+        // Counts a queued call on its receiver, see tryMoveToThread(). Returns the thread the call has to run on, read
+        // after the count so that a move in progress is waited out.
+        static std::size_t beginQueuedCall(TA_MetaObject *pReceiver) {
+            pReceiver->m_pQueuedCalls->increment();
+            return pReceiver->affinityThread();
+        }
+
         void removeConnectionReferences() {
             auto *pRealSender = resolveSender();
             auto *pRealReceiver = resolveReceiver();
@@ -609,10 +916,13 @@ class TA_MetaObject : public std::enable_shared_from_this<TA_MetaObject> {
                 return;
             }
             m_removeConnectionReferenceImpl<TA_MetaObject, TA_MetaObject>(
-                pRealSender, pRealReceiver,
-                std::forward<FuncMark>(m_senderFunc), std::forward<FuncMark>(m_receiverFunc));
+                pRealSender, pRealReceiver, this, m_signalIndex, std::forward<FuncMark>(m_receiverFunc));
         }
 
+        // Emissions that already hold a snapshot containing the connection skip it once it is disconnected.
+        bool isConnected() const { return m_connected.load(std::memory_order_acquire); }
+        void disconnect() { m_connected.store(false, std::memory_order_release); }
+
         TA_MetaObject *sender() const { return resolveSender(); }
         TA_MetaObject *receiver() const { return resolveReceiver(); }
 
@@ -620,15 +930,7 @@ class TA_MetaObject : public std::enable_shared_from_this<TA_MetaObject> {
 
         const FuncMark &signalMark() const { return m_senderFunc; }
         const FuncMark &slotMark() const { return m_receiverFunc; }
-
-        bool isSync() const {
-            auto *pRealSender = resolveSender();
-            auto *pRealReceiver = resolveReceiver();
-            if (!pRealSender || !pRealReceiver) return false;
-
-            return pRealSender->affinityThread() == pRealReceiver->affinityThread() &&
-                   (m_type == TA_ConnectionType::Auto || m_type == TA_ConnectionType::Direct);
-        }
+        SignalIndex signalIndex() const { return m_signalIndex; }
 
         bool isAutoDestroy() const { return m_autoDestroy; }
 
@@ -653,45 +955,158 @@ class TA_MetaObject : public std::enable_shared_from_this<TA_MetaObject> {
         TA_MetaObject *m_pSender{nullptr}, *m_pReceiver{nullptr};
         std::weak_ptr<TA_MetaObject> m_wpSender{}, m_wpReceiver{};
         FuncMark m_senderFunc{}, m_receiverFunc{};
+        SignalIndex m_signalIndex{0};
         TA_ConnectionType m_type;
-        std::any m_para;
         SlotExpType m_slotExp {};
+        std::atomic_bool m_connected{true};
+        std::atomic<std::shared_ptr<std::any>> m_pPendingPayload{nullptr};
+        std::atomic_bool m_deliveryScheduled{false};
         const bool m_autoDestroy{false};
     };
 
   private:
     void destroyConnections() {
-        for (auto &&[signal, obj] : m_outputConnections) {
-            auto receiver = obj->receiver();
-            if(!receiver) {
-                continue;
-            }
-            auto &&[start, end] = receiver->m_inputConnections.equal_range(obj->slotMark());
-            while (start != end) {
-                if (start->second == obj) {
-                    receiver->m_inputConnections.erase(start);
-                    break;
+        const ConnectionTable *pTable{takeConnectionTable()};
+        if (pTable) {
+            for (auto &[index, pConnections] : pTable->lists) {
+                for (auto &obj : *pConnections) {
+                    obj->disconnect();
+                    auto receiver = obj->receiver();
+                    if(!receiver) {
+                        continue;
+                    }
+                    receiver->removeInputConnection(obj->slotMark(), obj.get());
                 }
-                ++start;
             }
         }
-        m_outputConnections.clear();
+        TA_EpochDomain::get().retire(pTable);
 
-        for (auto &&[slot, obj] : m_inputConnections) {
+        for (auto &&[slot, obj] : takeInputConnections()) {
+            obj->disconnect();
             auto sender = obj->sender();
             if(!sender) {
                 continue;
             }
-            auto &&[start, end] = sender->m_outputConnections.equal_range(obj->signalMark());
-            while (start != end) {
-                if (start->second == obj) {
-                    sender->m_outputConnections.erase(start);
-                    break;
+            sender->eraseConnection(obj->signalIndex(), obj.get());
+        }
+    }
+
+    // Snapshot of the connections of one signal. It stays valid as long as the calling thread pins the epoch domain.
+    const ConnectionList *connections(SignalIndex index) const {
+        const ConnectionTable *pTable{m_pConnectionTable.load(std::memory_order_acquire)};
+        if (!pTable) {
+            return nullptr;
+        }
+        auto iter{pTable->find(index)};
+        return iter != pTable->lists.end() && iter->first == index ? iter->second.get() : nullptr;
+    }
+
+    // Copy-on-write edit of the connections of one signal. Writers are serialized by the connection mutex, the result
+    // is published with a single pointer swap and the replaced table is retired to the epoch domain. The edit returns
+    // false to leave the table untouched.
+    template <typename Edit> bool editConnections(SignalIndex index, Edit &&edit) {
+        const ConnectionTable *pTable{nullptr};
+        {
+            std::lock_guard<std::mutex> locker(m_connectionMutex);
+            pTable = m_pConnectionTable.load(std::memory_order_relaxed);
+            ConnectionList connections;
+            if (pTable) {
+                auto iter{pTable->find(index)};
+                if (iter != pTable->lists.end() && iter->first == index) {
+                    connections = *iter->second;
                 }
-                ++start;
             }
+            if (!edit(connections)) {
+                return false;
+            }
+            auto *pNewTable = pTable ? new ConnectionTable(*pTable) : new ConnectionTable{};
+            auto iter{pNewTable->find(index)};
+            const bool found{iter != pNewTable->lists.end() && iter->first == index};
+            if (connections.empty()) {
+                if (found) {
+                    pNewTable->lists.erase(iter);
+                }
+            } else {
+                auto pList{std::make_shared<const ConnectionList>(std::move(connections))};
+                if (found) {
+                    iter->second = std::move(pList);
+                } else {
+                    pNewTable->lists.emplace(iter, index, std::move(pList));
+                }
+            }
+            m_pConnectionTable.store(pNewTable, std::memory_order_release);
         }
-        m_inputConnections.clear();
+        TA_EpochDomain::get().retire(pTable);
+        return true;
+    }
+
+    bool eraseConnection(SignalIndex index, const TA_ConnectionObject *pConnection) {
+        return editConnections(index, [pConnection](ConnectionList &connections) {
+            auto iter = std::find_if(connections.begin(), connections.end(),
+                                     [pConnection](auto &obj) { return obj.get() == pConnection; });
+            if (iter == connections.end()) {
+                return false;
+            }
+            (*iter)->disconnect();
+            connections.erase(iter);
+            return true;
+        });
+    }
+
+    const ConnectionTable *copyConnectionTable() const {
+        std::lock_guard<std::mutex> locker(m_connectionMutex);
+        const ConnectionTable *pTable{m_pConnectionTable.load(std::memory_order_relaxed)};
+        return pTable ? new ConnectionTable(*pTable) : nullptr;
+    }
+
+    const ConnectionTable *takeConnectionTable() {
+        std::lock_guard<std::mutex> locker(m_connectionMutex);
+        return m_pConnectionTable.exchange(nullptr, std::memory_order_acq_rel);
+    }
+
+    void publishConnectionTable(const ConnectionTable *pTable) {
+        const ConnectionTable *pOldTable{nullptr};
+        {
+            std::lock_guard<std::mutex> locker(m_connectionMutex);
+            pOldTable = m_pConnectionTable.exchange(pTable, std::memory_order_acq_rel);
+        }
+        TA_EpochDomain::get().retire(pOldTable);
+    }
+
+    using InputConnections = std::unordered_multimap<TA_ConnectionObject::FuncMark, std::shared_ptr<TA_ConnectionObject>>;
+
+    // The incoming connections are only bookkeeping for the destruction of the receiver, so any thread may update them
+    // under the input mutex. Connecting and disconnecting therefore never wait for the receiver's thread.
+    void addInputConnection(TA_ConnectionObject::FuncMark slot, std::shared_ptr<TA_ConnectionObject> pConnection) {
+        std::lock_guard<std::mutex> locker(m_inputMutex);
+        m_inputConnections.emplace(slot, std::move(pConnection));
+    }
+
+    bool removeInputConnection(TA_ConnectionObject::FuncMark slot, const TA_ConnectionObject *pConnection) {
+        std::lock_guard<std::mutex> locker(m_inputMutex);
+        auto &&[start, end] = m_inputConnections.equal_range(slot);
+        for (; start != end; ++start) {
+            if (start->second.get() == pConnection) {
+                m_inputConnections.erase(start);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    InputConnections copyInputConnections() const {
+        std::lock_guard<std::mutex> locker(m_inputMutex);
+        return m_inputConnections;
+    }
+
+    InputConnections takeInputConnections() {
+        std::lock_guard<std::mutex> locker(m_inputMutex);
+        return std::exchange(m_inputConnections, {});
+    }
+
+    void resetInputConnections(InputConnections &&connections) {
+        std::lock_guard<std::mutex> locker(m_inputMutex);
+        m_inputConnections = std::move(connections);
     }
 
     void updateAffinityThread() {
@@ -702,44 +1117,52 @@ class TA_MetaObject : public std::enable_shared_from_this<TA_MetaObject> {
     const std::thread::id m_sourceThread;
     std::atomic_size_t m_affinityThreadIdx;
     PendingCounter m_pendingCounter {};
+    // Shared with the queued calls, which may end after a receiver passed to deleteLater() was reclaimed.
+    std::shared_ptr<PendingCounter> m_pQueuedCalls{std::make_shared<PendingCounter>()};
     std::atomic_bool m_isBeingDestroyed{false};
 
-    std::unordered_multimap<TA_ConnectionObject::FuncMark, std::shared_ptr<TA_ConnectionObject>> m_outputConnections{};
-    std::unordered_multimap<TA_ConnectionObject::FuncMark, std::shared_ptr<TA_ConnectionObject>> m_inputConnections{};
+    // Keyed by signal, see indexOfSignal(). Readers load it without locking, see connections().
+    std::atomic<const ConnectionTable *> m_pConnectionTable{nullptr};
+    // Next free signal index, 0 is kept for signals that are not reflected.
+    inline static std::atomic<SignalIndex> m_signalCount{1};
+    mutable std::mutex m_connectionMutex;
+    mutable std::mutex m_inputMutex;
+    InputConnections m_inputConnections{};
 
-  private:
-    template <SmartPtrType Sender, SmartPtrType Receiver>
-    inline static auto m_isConnectionExistedImpl =
-        [](Sender pSender, TA_ConnectionObject::FuncMark &&signal,
-           Receiver pReceiver, TA_ConnectionObject::FuncMark &&slot) -> bool {
-        auto &&[startSendIter, endSendIter] = pSender->m_outputConnections.equal_range(signal);
-        while (startSendIter != endSendIter) {
-            if (startSendIter->second->receiver() == pReceiver.get() &&
-                startSendIter->second->slotMark() == slot) {
-                return true;
-            }
-            startSendIter++;
-        }
-        return false;
-    };
+    // Set once by enableMailbox(), read without locking on every queued call.
+    std::shared_ptr<TA_Mailbox> m_pMailboxOwner{nullptr};
+    std::atomic<TA_Mailbox *> m_pMailbox{nullptr};
 
+    std::atomic_bool m_slotLoadSampled{false};
+    std::atomic<std::chrono::nanoseconds::rep> m_slotBusyNanos{0};
+    std::atomic_uint64_t m_slotMessages{0};
+
+  private:
     template <PointerType Sender, typename Signal, typename... Args>
     inline static auto m_emitSignalImpl = [](Sender pSender, Signal signal, Args... args) -> void {
         if (!pSender) {
             return;
         }
         using RawType = typename ExtractRawType<Sender>::type;
-        auto [startIter, endIter] = pSender->m_outputConnections.equal_range(
-            Reflex::TA_TypeInfo<RawType>::findName(std::forward<Signal>(signal)));
-        while (startIter != endIter) {
-            auto obj = startIter++->second;
-            if(startIter != endIter) {
-                obj->setPara(args...);
-            } else {
-                obj->setPara(std::move(args)...);
+        SignalIndex signalIndex{indexOfSignal<RawType>(std::forward<Signal>(signal))};
+        auto guard = TA_EpochDomain::get().pin();
+        const ConnectionList *pConnections = pSender->connections(signalIndex);
+        if (!pConnections) {
+            return;
+        }
+        // Connections made by a slot during the emission are not part of the snapshot, the ones it breaks are
+        // skipped.
+        TA_SlotBatch batch;
+        SignalPayload pPayload{std::make_shared<std::any>(std::tuple<Args...>(std::move(args)...))};
+        for (std::size_t idx = 0; idx < pConnections->size(); ++idx) {
+            auto &obj = (*pConnections)[idx];
+            if (obj->isConnected()) {
+                obj->callSlot(batch, pPayload, idx + 1 == pConnections->size());
             }
-            obj->callSlot();
         }
+        // Released before the batch is posted, the last queued call can then move the arguments.
+        pPayload.reset();
+        batch.post();
     };
 
     template <typename Sender>
@@ -753,79 +1176,34 @@ class TA_MetaObject : public std::enable_shared_from_this<TA_MetaObject> {
         }
         Sender *pSender = pConnection->sender();
         if(pSender) {
-            auto &&signalMark = pConnection->signalMark();
-            auto &&slotMark = pConnection->slotMark();
-            auto &&[startSendIter, endSendIter] = pSender->m_outputConnections.equal_range(signalMark);
-            if (startSendIter == endSendIter)
+            const bool erased{pSender->eraseConnection(pConnection->signalIndex(), pConnection.get())};
+            if (!erased && !pConnection->isConnected())
                 return false;
-            while (startSendIter != endSendIter) {
-                if (startSendIter->second == pConnection) {
-                    pSender->m_outputConnections.erase(startSendIter);
-                    break;
-                }
-                startSendIter++;
-            }
         }
         holder.reset();
         return true;
     };
 
     template <SmartPtrType Sender, SmartPtrType Receiver>
-    inline static auto m_unregisterConnectionImpl = [](Sender pSender, TA_ConnectionObject::FuncMark &&signal,
+    inline static auto m_unregisterConnectionImpl = [](Sender pSender, SignalIndex &&signal,
                                                         Receiver pReceiver, TA_ConnectionObject::FuncMark &&slot) -> bool {
         std::shared_ptr<TA_ConnectionObject> pConnection{nullptr};
-        auto senderUnregisterExp = [&pConnection, pSender, signal, pReceiver, slot]() ->bool {
-            auto &&[startSendIter, endSendIter] = pSender->m_outputConnections.equal_range(signal);
-            if (startSendIter == endSendIter)
-                return false;
-            while (startSendIter != endSendIter) {
-                if (startSendIter->second->receiver() == pReceiver.get() &&
-                    startSendIter->second->slotMark() == slot) {
-                    pConnection = startSendIter->second;
-                    pSender->m_outputConnections.erase(startSendIter);
-                    break;
-                }
-                startSendIter++;
-            }
-            return true;
-        };
-        if(isOnCurrentThread(pSender)) {
-            senderUnregisterExp();
-        } else {
-            auto senderActivity = TA_ActivityCreator::create(std::move(senderUnregisterExp));
-            senderActivity->setStolenEnabled(false);
-            // Ensure the activity completes before proceeding to receiver side.
-            // Previously this used invokeActivity(...) and discarded the returned task,
-            // which could destroy the awaiting coroutine before resumption.
-            auto fetcher = TA_ThreadHolder::get().postActivity(senderActivity, true);
-            fetcher();
-            //AsyncTaskRes res = invokeActivity(senderActivity, pSender);
-            //res.get();
-        }
-        auto receiverUnregisterExp = [&pConnection, pReceiver, &slot]() -> bool {
-            if (!pConnection) {
+        pSender->editConnections(signal, [&pConnection, &pReceiver, &slot](ConnectionList &connections) {
+            auto iter = std::find_if(connections.begin(), connections.end(), [&pReceiver, &slot](auto &obj) {
+                return obj->receiver() == pReceiver.get() && obj->slotMark() == slot;
+            });
+            if (iter == connections.end()) {
                 return false;
             }
-            auto &&[startRecIter, endRecIter] = pReceiver->m_inputConnections.equal_range(slot);
-            if (startRecIter == endRecIter)
-                return false;
-            while (startRecIter != endRecIter) {
-                if (startRecIter->second == pConnection) {
-                    pReceiver->m_inputConnections.erase(startRecIter);
-                    break;
-                }
-                startRecIter++;
-            }
+            pConnection = *iter;
+            pConnection->disconnect();
+            connections.erase(iter);
             return true;
-        };
-        if(isOnCurrentThread(pReceiver)) {
-            return receiverUnregisterExp();
+        });
+        if (!pConnection) {
+            return false;
         }
-        auto receiverActivity = TA_ActivityCreator::create(std::move(receiverUnregisterExp));
-        receiverActivity->setStolenEnabled(false);
-        AsyncTaskRes res = invokeActivity(receiverActivity, pReceiver.get());
-        auto taskResult = res.get();
-        return taskResult->template get<bool>();
+        return pReceiver->removeInputConnection(slot, pConnection.get());
     };
 
     template <SmartPtrType Sender, typename Signal, LambdaExpType Exp>
@@ -833,21 +1211,24 @@ class TA_MetaObject : public std::enable_shared_from_this<TA_MetaObject> {
                                                            Exp exp, TA_ConnectionType type,
                                                            bool autoDestroy) -> TA_ConnectionObjectHolder {
         using RawSenderType = typename ExtractRawType<Sender>::type;
-        TA_ConnectionObject::FuncMark signalMark{
-            Reflex::TA_TypeInfo<std::decay_t<RawSenderType>>::findName(std::forward<Signal>(signal))};
+        SignalIndex signalIndex{indexOfSignal<RawSenderType>(std::forward<Signal>(signal))};
         TA_ConnectionObject::FuncMark slotMark{typeid(Exp).name()};
-        auto &&[startSendIter, endSendIter] = pSender->m_outputConnections.equal_range(signalMark);
-        while (startSendIter != endSendIter) {
-            if (startSendIter->second->receiver() == pSender.get() && startSendIter->second->slotMark() == slotMark) {
-                return {nullptr};
+        std::shared_ptr<TA_ConnectionObject> conn{nullptr};
+        pSender->editConnections(signalIndex, [&](ConnectionList &connections) {
+            // Only captureless lambdas of the same type are duplicates, capturing ones may carry different state.
+            if constexpr (std::is_empty_v<std::decay_t<Exp>>) {
+                for (auto &obj : connections) {
+                    if (obj->receiver() == pSender.get() && obj->slotMark() == slotMark) {
+                        return false;
+                    }
+                }
             }
-            startSendIter++;
-        }
-
-        auto &&conn = std::make_shared<TA_ConnectionObject>(pSender.get(), std::move(signal), type, autoDestroy);
-        conn->initSlotObject(std::move(exp));
-        pSender->m_outputConnections.emplace(signalMark, conn->getSharedPtr());
-        if (autoDestroy)
+            conn = std::make_shared<TA_ConnectionObject>(pSender.get(), std::move(signal), type, autoDestroy);
+            conn->initSlotObject(std::move(exp));
+            connections.emplace_back(conn);
+            return true;
+        });
+        if (!conn || autoDestroy)
             return {nullptr};
         return {conn};
     };
@@ -861,79 +1242,24 @@ class TA_MetaObject : public std::enable_shared_from_this<TA_MetaObject> {
         using RawReceiverType = typename ExtractRawType<Receiver>::type;
         TA_ConnectionObject::FuncMark slotMark {
             Reflex::TA_TypeInfo<std::decay_t<RawReceiverType>>::findName(std::forward<Slot>(slot))};
-        if(pSender->affinityThread() == pReceiver->affinityThread()) {
-            auto syncRegisterExp = [pSender, &signal, pReceiver, &slot, type, slotMark]() -> bool {
-                TA_ConnectionObject::FuncMark signalMark{
-                    Reflex::TA_TypeInfo<std::decay_t<RawSenderType>>::findName(std::forward<Signal>(signal))};
-                auto &&[startSendIter, endSendIter] = pSender->m_outputConnections.equal_range(signalMark);
-                while (startSendIter != endSendIter) {
-                    if (startSendIter->second->receiver() == pReceiver.get() &&
-                        startSendIter->second->slotMark() == slotMark) {
-                        return false;
-                    }
-                    startSendIter++;
+        SignalIndex signalIndex{indexOfSignal<RawSenderType>(std::forward<Signal>(signal))};
+        SharedConnection conn{nullptr};
+        pSender->editConnections(signalIndex, [&](ConnectionList &connections) {
+            for (auto &obj : connections) {
+                if (obj->receiver() == pReceiver.get() && obj->slotMark() == slotMark) {
+                    return false;
                 }
-
-                auto &&conn = std::make_shared<TA_ConnectionObject>(pSender.get(), std::move(signal), type);
-                conn->initSlotObject(pReceiver.get(), std::forward<Slot>(slot));
-                pSender->m_outputConnections.emplace(signalMark, conn->getSharedPtr());
-                pReceiver->m_inputConnections.emplace(slotMark, conn->getSharedPtr());
-                return true;
-            };
-            if(isOnCurrentThread(pSender)) {
-                return syncRegisterExp();
-            } else {
-                auto syncActivity = TA_ActivityCreator::create(std::move(syncRegisterExp));
-                syncActivity->setStolenEnabled(false);
-                AsyncTaskRes res = invokeActivity(syncActivity, pSender.get());
-                auto taskResult = res.get();
-                return taskResult->template get<bool>();
-            }
-        } else {
-            auto senderRegisterExp = [pSender, &signal, pReceiver, &slot, type, &slotMark]() -> SharedConnection {
-                TA_ConnectionObject::FuncMark signalMark{
-                    Reflex::TA_TypeInfo<std::decay_t<RawSenderType>>::findName(std::forward<Signal>(signal))};
-                auto &&[startSendIter, endSendIter] = pSender->m_outputConnections.equal_range(signalMark);
-                while (startSendIter != endSendIter) {
-                    if (startSendIter->second->receiver() == pReceiver.get() &&
-                        startSendIter->second->slotMark() == slotMark) {
-                        return nullptr;
-                    }
-                    startSendIter++;
-                }
-
-                auto &&conn = std::make_shared<TA_ConnectionObject>(pSender.get(), std::move(signal), type);
-                conn->initSlotObject(pReceiver.get(), std::forward<Slot>(slot));
-                pSender->m_outputConnections.emplace(signalMark, conn->getSharedPtr());
-                return conn;
-            };
-            SharedConnection connectionObj {nullptr};
-            if(isOnCurrentThread(pSender)) {
-                connectionObj = senderRegisterExp();
-            } else {
-                auto senderRegisterActivity = TA_ActivityCreator::create(std::move(senderRegisterExp));
-                senderRegisterActivity->setStolenEnabled(false);
-                AsyncTaskRes res = invokeActivity(senderRegisterActivity, pSender.get());
-                auto taskResult = res.get();
-                connectionObj = taskResult->template get<SharedConnection>();
-
-            }
-            if(!connectionObj) {
-                return false;
-            }
-            auto receiverRegisterExp = [pReceiver, &slotMark, &connectionObj]() -> void {
-                pReceiver->m_inputConnections.emplace(slotMark, connectionObj->getSharedPtr());
-            };
-            if(isOnCurrentThread(pReceiver)) {
-                receiverRegisterExp();
-            } else {
-                auto addIntoReceiverActivity = TA_ActivityCreator::create(std::move(receiverRegisterExp));
-                addIntoReceiverActivity->setStolenEnabled(false);
-                AsyncTaskRes res = invokeActivity(addIntoReceiverActivity, pReceiver.get());
-                auto taskResult = res.get();
             }
+            conn = std::make_shared<TA_ConnectionObject>(pSender.get(), std::move(signal), type);
+            conn->initSlotObject(pReceiver.get(), std::forward<Slot>(slot));
+            connections.emplace_back(conn);
             return true;
+        });
+        if (!conn) {
+            return false;
         }
+        pReceiver->addInputConnection(slotMark, std::move(conn));
+        return true;
     };
 
     bool(*m_moveToThreadImpl)(std::size_t idx, std::atomic_size_t &affintyThread) =
@@ -947,36 +1273,13 @@ class TA_MetaObject : public std::enable_shared_from_this<TA_MetaObject> {
 
     template <typename Sender, typename Receiver>
     inline static auto m_removeConnectionReferenceImpl = [](Sender *pSender, Receiver *pReceiver,
-                                                             TA_ConnectionObject::FuncMark &&signal,
+                                                             const TA_ConnectionObject *pConnection, SignalIndex signal,
                                                              TA_ConnectionObject::FuncMark &&slot) -> void {
-       auto senderExp =
-            [](Sender *pSender, TA_ConnectionObject::FuncMark &&signal) -> void {
-            auto rangeSender = pSender->m_outputConnections.equal_range(signal);
-            for (auto iter = rangeSender.first; iter != rangeSender.second; ++iter) {
-                if (iter->second->sender() == pSender) {
-                    pSender->m_outputConnections.erase(iter);
-                    break;
-                }
-            }
-        };
-        senderExp(pSender, std::forward<TA_ConnectionObject::FuncMark>(signal));
+        pSender->eraseConnection(signal, pConnection);
         if(pSender == pReceiver) {
             return;
         }
-        auto receiverExp = [pReceiver, &slot]() -> void {
-            auto rangeReceiver = pReceiver->m_inputConnections.equal_range(slot);
-            for (auto iter = rangeReceiver.first; iter != rangeReceiver.second; ++iter) {
-                if (iter->second->receiver() == pReceiver) {
-                    pReceiver->m_inputConnections.erase(iter);
-                    break;
-                }
-            }
-        };
-        auto receiverActivity = TA_ActivityCreator::create(std::move(receiverExp));
-        receiverActivity->moveToThread(pReceiver->affinityThread());
-        receiverActivity->setStolenEnabled(false);
-        auto fetcher = TA_ThreadHolder::get().postActivity(receiverActivity, true);
-        fetcher();
+        pReceiver->removeInputConnection(slot, pConnection);
     };
 };
 
@@ -302,6 +302,13 @@ template <typename T, typename... BASES> struct TA_MetaTypeInfo : TA_MetaTypeAtt
         return findName(std::forward<VALUE>(v), std::make_index_sequence<std::tuple_size_v<decltype(aggregate())>>{});
     }
 
+    // Position of the field counted from the end of aggregate(), starting at 1, or 0 when the value is not reflected.
+    // Base fields are aggregated behind the fields of the derived type, so along a single inheritance chain a field
+    // keeps the same index in every type that derives from the one registering it.
+    template <typename VALUE> static constexpr std::size_t findIndex(VALUE &&v) {
+        return findIndex(std::forward<VALUE>(v), std::make_index_sequence<std::tuple_size_v<decltype(aggregate())>>{});
+    }
+
     static constexpr auto findTypeValue(std::string_view &str) // run time finding
     {
         return findValue(std::forward<std::string_view>(str),
@@ -422,6 +429,22 @@ template <typename T, typename... BASES> struct TA_MetaTypeInfo : TA_MetaTypeAtt
         return containsField(std::forward<VALUE>(v), std::index_sequence<IDXS...>{});
     }
 
+    template <typename VALUE, std::size_t... IDXS>
+    static constexpr std::size_t findIndex(VALUE &&v, std::index_sequence<IDXS...>) {
+        std::size_t index{0};
+        // The last match wins, it belongs to the most basic type registering the field.
+        ((index = matchesField<IDXS>(v) ? size() - IDXS : index), ...);
+        return index;
+    }
+
+    template <std::size_t IDX, typename VALUE> static constexpr bool matchesField(const VALUE &v) {
+        if constexpr (std::is_same_v<decltype(std::get<IDX>(aggregate()).value()), std::decay_t<VALUE>>) {
+            return v == std::get<IDX>(aggregate()).value();
+        } else {
+            return false;
+        }
+    }
+
     template <typename VALUE> static constexpr auto findName(VALUE &&, std::index_sequence<>) {
         return std::string_view{}.data();
     }
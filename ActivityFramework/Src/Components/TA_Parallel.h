@@ -0,0 +1,285 @@
+/*
+ * Copyright [2025] [Shuang Zhu / Sol]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TA_PARALLEL_H
+#define TA_PARALLEL_H
+
+#include "TA_Activity.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <vector>
+
+namespace CoreAsync {
+/*
+ * Data-parallel algorithms running on the global thread pool.
+ *
+ * Work is cut into contiguous chunks of at least sequentialThreshold elements. The calling thread takes part in
+ * the work and claims chunks from the same counter as the pooled helpers, so a call never blocks on a helper that
+ * has not been scheduled yet and is safe to issue from inside an activity. Each chunk is processed by a plain
+ * sequential loop over contiguous memory so that the compiler is free to vectorize it.
+ */
+class TA_Parallel {
+  public:
+    static constexpr std::size_t sequentialThreshold{1 << 15};
+
+    template <std::random_access_iterator It, typename Compare = std::less<>>
+    static void sort(It first, It last, Compare comp = {}) {
+        sortImpl<false>(first, last, comp);
+    }
+
+    template <std::random_access_iterator It, typename Compare = std::less<>>
+    static void stableSort(It first, It last, Compare comp = {}) {
+        sortImpl<true>(first, last, comp);
+    }
+
+    template <std::random_access_iterator In1, std::random_access_iterator In2, std::random_access_iterator Out,
+              typename Compare = std::less<>>
+    static Out merge(In1 first1, In1 last1, In2 first2, In2 last2, Out out, Compare comp = {}) {
+        const std::size_t total{static_cast<std::size_t>((last1 - first1) + (last2 - first2))};
+        const std::size_t pieces{chunkCount(total)};
+        parallelFor(pieces, [&](std::size_t piece) {
+            mergePiece<false>(first1, last1 - first1, first2, last2 - first2, out, total * piece / pieces,
+                              total * (piece + 1) / pieces, comp);
+        });
+        return out + total;
+    }
+
+    // The operation must be associative, the chunk partial results are combined in a different grouping than a
+    // left-to-right fold would use. It need not be commutative, every chunk is folded and combined in order.
+    template <std::random_access_iterator In, std::random_access_iterator Out, typename BinaryOp = std::plus<>>
+    static Out inclusiveScan(In first, In last, Out out, BinaryOp op = {}) {
+        using ValueType = std::iter_value_t<In>;
+        const std::size_t size{static_cast<std::size_t>(last - first)};
+        const std::size_t chunks{chunkCount(size)};
+        if (chunks <= 1) {
+            return std::inclusive_scan(first, last, out, op);
+        }
+        std::vector<ValueType> sums(chunks);
+        parallelFor(chunks, [&](std::size_t chunk) {
+            auto begin{first + size * chunk / chunks}, end{first + size * (chunk + 1) / chunks};
+            sums[chunk] = std::accumulate(std::next(begin), end, *begin, op);
+        });
+        std::inclusive_scan(sums.begin(), sums.end(), sums.begin(), op);
+        parallelFor(chunks, [&](std::size_t chunk) {
+            auto begin{first + size * chunk / chunks}, end{first + size * (chunk + 1) / chunks};
+            auto dst{out + size * chunk / chunks};
+            if (chunk == 0) {
+                std::inclusive_scan(begin, end, dst, op);
+            } else {
+                std::inclusive_scan(begin, end, dst, op, sums[chunk - 1]);
+            }
+        });
+        return out + size;
+    }
+
+    template <std::random_access_iterator In, std::random_access_iterator Out, typename T,
+              typename BinaryOp = std::plus<>>
+    static Out exclusiveScan(In first, In last, Out out, T init, BinaryOp op = {}) {
+        const std::size_t size{static_cast<std::size_t>(last - first)};
+        const std::size_t chunks{chunkCount(size)};
+        if (chunks <= 1) {
+            return std::exclusive_scan(first, last, out, std::move(init), op);
+        }
+        std::vector<T> offsets(chunks, init);
+        parallelFor(chunks - 1, [&](std::size_t chunk) {
+            auto begin{first + size * chunk / chunks}, end{first + size * (chunk + 1) / chunks};
+            offsets[chunk + 1] = std::accumulate(std::next(begin), end, static_cast<T>(*begin), op);
+        });
+        for (std::size_t chunk = 1; chunk < chunks; ++chunk) {
+            offsets[chunk] = op(offsets[chunk - 1], offsets[chunk]);
+        }
+        parallelFor(chunks, [&](std::size_t chunk) {
+            auto begin{first + size * chunk / chunks}, end{first + size * (chunk + 1) / chunks};
+            std::exclusive_scan(begin, end, out + size * chunk / chunks, offsets[chunk], op);
+        });
+        return out + size;
+    }
+
+    template <typename Fn> static void parallelFor(std::size_t taskCount, Fn &&fn) {
+        if (taskCount == 0) {
+            return;
+        }
+        auto &pool = TA_ThreadHolder::get();
+        if (taskCount == 1 || pool.size() <= 1) {
+            for (std::size_t idx = 0; idx < taskCount; ++idx) {
+                fn(idx);
+            }
+            return;
+        }
+        auto pState = std::make_shared<ForState>(taskCount);
+        auto task = [](const std::shared_ptr<ForState> &pState, auto &fn) {
+            std::size_t idx;
+            while ((idx = pState->next.fetch_add(1, std::memory_order_acq_rel)) < pState->count) {
+                try {
+                    fn(idx);
+                } catch (...) {
+                    std::lock_guard<std::mutex> locker(pState->mutex);
+                    if (!pState->exception) {
+                        pState->exception = std::current_exception();
+                    }
+                }
+                if (pState->done.fetch_add(1, std::memory_order_acq_rel) + 1 == pState->count) {
+                    pState->done.notify_all();
+                }
+            }
+        };
+        auto *pFn = &fn;
+        const std::size_t helpers{std::min(taskCount - 1, pool.size())};
+        for (std::size_t idx = 0; idx < helpers; ++idx) {
+            [[maybe_unused]] auto fetcher = pool.postActivity(
+                TA_ActivityCreator::create([pState, pFn, task]() { task(pState, *pFn); }), true);
+        }
+        task(pState, fn);
+        std::size_t finished{pState->done.load(std::memory_order_acquire)};
+        while (finished < taskCount) {
+            pState->done.wait(finished, std::memory_order_acquire);
+            finished = pState->done.load(std::memory_order_acquire);
+        }
+        if (pState->exception) {
+            std::rethrow_exception(pState->exception);
+        }
+    }
+
+  private:
+    struct ForState {
+        explicit ForState(std::size_t taskCount) : count(taskCount) {}
+
+        const std::size_t count;
+        std::atomic_size_t next{0};
+        std::atomic_size_t done{0};
+        std::mutex mutex;
+        std::exception_ptr exception{nullptr};
+    };
+
+    static std::size_t chunkCount(std::size_t size) {
+        const std::size_t workers{TA_ThreadHolder::get().size() + 1};
+        return std::max<std::size_t>(1, std::min(size / sequentialThreshold, workers));
+    }
+
+    // Merge path: number of elements taken from the first sequence among the first k outputs. Ties are resolved in
+    // favour of the first sequence, which keeps the merge stable.
+    template <typename In1, typename In2, typename Compare>
+    static std::size_t coRank(std::size_t k, In1 first1, std::size_t size1, In2 first2, std::size_t size2,
+                              Compare &comp) {
+        std::size_t low{k > size2 ? k - size2 : 0}, high{std::min(k, size1)};
+        while (low < high) {
+            std::size_t i{low + (high - low) / 2}, j{k - i};
+            if (j > 0 && !comp(first2[j - 1], first1[i])) {
+                low = i + 1;
+            } else {
+                high = i;
+            }
+        }
+        return low;
+    }
+
+    template <bool Move, typename In1, typename In2, typename Out, typename Compare>
+    static void mergePiece(In1 first1, std::size_t size1, In2 first2, std::size_t size2, Out out, std::size_t outBegin,
+                           std::size_t outEnd, Compare &comp) {
+        std::size_t i0{coRank(outBegin, first1, size1, first2, size2, comp)};
+        std::size_t i1{coRank(outEnd, first1, size1, first2, size2, comp)};
+        std::size_t j0{outBegin - i0}, j1{outEnd - i1};
+        if constexpr (Move) {
+            std::merge(std::make_move_iterator(first1 + i0), std::make_move_iterator(first1 + i1),
+                       std::make_move_iterator(first2 + j0), std::make_move_iterator(first2 + j1), out + outBegin,
+                       comp);
+        } else {
+            std::merge(first1 + i0, first1 + i1, first2 + j0, first2 + j1, out + outBegin, comp);
+        }
+    }
+
+    template <bool Stable, typename It, typename Compare> static void sortImpl(It first, It last, Compare &comp) {
+        using ValueType = std::iter_value_t<It>;
+        const std::size_t size{static_cast<std::size_t>(last - first)};
+        const std::size_t runs{chunkCount(size)};
+        auto sequentialSort = [&comp](auto begin, auto end) {
+            if constexpr (Stable) {
+                std::stable_sort(begin, end, comp);
+            } else {
+                std::sort(begin, end, comp);
+            }
+        };
+        if (runs <= 1) {
+            sequentialSort(first, last);
+            return;
+        }
+        std::vector<std::size_t> bounds(runs + 1);
+        for (std::size_t run = 0; run <= runs; ++run) {
+            bounds[run] = size * run / runs;
+        }
+        parallelFor(runs, [&](std::size_t run) { sequentialSort(first + bounds[run], first + bounds[run + 1]); });
+
+        std::vector<ValueType> buffer(std::make_move_iterator(first), std::make_move_iterator(last));
+        bool inBuffer{true};
+        while (bounds.size() > 2) {
+            if (inBuffer) {
+                mergeRuns(buffer.begin(), first, bounds, comp);
+            } else {
+                mergeRuns(first, buffer.begin(), bounds, comp);
+            }
+            inBuffer = !inBuffer;
+            std::vector<std::size_t> merged;
+            merged.reserve(bounds.size() / 2 + 1);
+            for (std::size_t run = 0; run + 1 < bounds.size(); run += 2) {
+                merged.emplace_back(bounds[run]);
+            }
+            merged.emplace_back(size);
+            bounds.swap(merged);
+        }
+        if (inBuffer) {
+            const std::size_t chunks{chunkCount(size)};
+            parallelFor(chunks, [&](std::size_t chunk) {
+                auto begin{buffer.begin() + size * chunk / chunks}, end{buffer.begin() + size * (chunk + 1) / chunks};
+                std::move(begin, end, first + size * chunk / chunks);
+            });
+        }
+    }
+
+    // One level of the bottom-up merge: adjacent runs are merged pairwise and every pair is split along its merge
+    // path, so the last levels keep all workers busy instead of degrading to a single sequential merge.
+    template <typename Src, typename Dst, typename Compare>
+    static void mergeRuns(Src src, Dst dst, const std::vector<std::size_t> &bounds, Compare &comp) {
+        struct Piece {
+            std::size_t left, mid, right, outBegin, outEnd;
+        };
+        const std::size_t size{bounds.back()};
+        const std::size_t grain{std::max<std::size_t>(sequentialThreshold, size / chunkCount(size))};
+        std::vector<Piece> pieces;
+        for (std::size_t run = 0; run + 1 < bounds.size(); run += 2) {
+            std::size_t left{bounds[run]}, mid{bounds[run + 1]};
+            std::size_t right{run + 2 < bounds.size() ? bounds[run + 2] : mid};
+            std::size_t length{right - left}, count{std::max<std::size_t>(1, length / grain)};
+            for (std::size_t idx = 0; idx < count; ++idx) {
+                pieces.emplace_back(Piece{left, mid, right, length * idx / count, length * (idx + 1) / count});
+            }
+        }
+        parallelFor(pieces.size(), [&](std::size_t idx) {
+            const Piece &piece{pieces[idx]};
+            mergePiece<true>(src + piece.left, piece.mid - piece.left, src + piece.mid, piece.right - piece.mid,
+                             dst + piece.left, piece.outBegin, piece.outEnd, comp);
+        });
+    }
+};
+} // namespace CoreAsync
+
+#endif // TA_PARALLEL_H
@@ -0,0 +1,147 @@
+/*
+ * Copyright [2025] [Shuang Zhu / Sol]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Components/TA_PipelineCheckpoint.h"
+
+#include <cassert>
+#include <filesystem>
+#include <mutex>
+#include <unordered_map>
+
+namespace CoreAsync {
+namespace {
+struct Registry {
+    struct Entry {
+        TA_PipelineCheckpoint::TypeTag tag;
+        std::function<void(TA_Serializer<BufferWriter> &, const TA_DefaultVariant &)> writer;
+    };
+
+    static Registry &get() {
+        static Registry registry;
+        return registry;
+    }
+
+    std::mutex mutex;
+    std::unordered_map<std::size_t, Entry> writers;
+    std::unordered_map<TA_PipelineCheckpoint::TypeTag,
+                       std::function<TA_DefaultVariant(TA_Serializer<BufferReader> &)>>
+        readers;
+};
+} // namespace
+
+bool TA_PipelineCheckpoint::registerImpl(std::size_t typeId, TypeTag tag, Writer writer, Reader reader) {
+    if (tag == invalidTag) {
+        assert(tag != invalidTag);
+        TA_CommonTools::debugInfo(META_STRING("Register checkpoint type failed!"));
+        return false;
+    }
+    auto &registry{Registry::get()};
+    std::lock_guard<std::mutex> locker(registry.mutex);
+    auto writerIter{registry.writers.find(typeId)};
+    if (writerIter != registry.writers.end()) {
+        return writerIter->second.tag == tag;
+    }
+    if (registry.readers.contains(tag)) {
+        TA_CommonTools::debugInfo(META_STRING("Checkpoint type tag is already in use!"));
+        return false;
+    }
+    registry.writers.emplace(typeId, Registry::Entry{tag, std::move(writer)});
+    registry.readers.emplace(tag, std::move(reader));
+    return true;
+}
+
+bool TA_PipelineCheckpoint::isRegistered(std::size_t typeId) {
+    auto &registry{Registry::get()};
+    std::lock_guard<std::mutex> locker(registry.mutex);
+    return registry.writers.contains(typeId);
+}
+
+bool TA_PipelineCheckpoint::save(const std::string &path, const Snapshot &snapshot) {
+    const std::string tmpPath{path + ".tmp"};
+    {
+        TA_Serializer output(tmpPath, 1, 64 * 1024);
+        output << magic << snapshot.activitySize << snapshot.startIndex << snapshot.position
+               << static_cast<std::uint64_t>(snapshot.results.size());
+        auto &registry{Registry::get()};
+        std::lock_guard<std::mutex> locker(registry.mutex);
+        for (const auto &var : snapshot.results) {
+            auto iter{var.isValid() ? registry.writers.find(var.typeId()) : registry.writers.end()};
+            if (iter == registry.writers.end()) {
+                output << invalidTag;
+            } else {
+                output << iter->second.tag;
+                iter->second.writer(output, var);
+            }
+        }
+        output << magic;
+    }
+    std::error_code error;
+    std::filesystem::rename(tmpPath, path, error);
+    if (error) {
+        TA_CommonTools::debugInfo(META_STRING("Save pipeline checkpoint failed!"));
+        std::filesystem::remove(tmpPath, error);
+        return false;
+    }
+    return true;
+}
+
+bool TA_PipelineCheckpoint::load(const std::string &path, Snapshot &snapshot) {
+    std::error_code error;
+    if (!std::filesystem::is_regular_file(path, error)) {
+        return false;
+    }
+    TA_Serializer<BufferReader> input(path, 1, 64 * 1024);
+    std::uint32_t head{0};
+    std::uint64_t resultSize{0};
+    Snapshot loaded;
+    input >> head >> loaded.activitySize >> loaded.startIndex >> loaded.position >> resultSize;
+    if (head != magic || resultSize != loaded.activitySize) {
+        TA_CommonTools::debugInfo(META_STRING("Invalid pipeline checkpoint!"));
+        return false;
+    }
+    loaded.results.resize(resultSize);
+    {
+        auto &registry{Registry::get()};
+        std::lock_guard<std::mutex> locker(registry.mutex);
+        for (auto &var : loaded.results) {
+            TypeTag tag{invalidTag};
+            input >> tag;
+            if (tag == invalidTag) {
+                continue;
+            }
+            auto iter{registry.readers.find(tag)};
+            if (iter == registry.readers.end()) {
+                TA_CommonTools::debugInfo(META_STRING("Unknown type in pipeline checkpoint!"));
+                return false;
+            }
+            var = iter->second(input);
+        }
+    }
+    std::uint32_t tail{0};
+    input >> tail;
+    if (tail != magic) {
+        TA_CommonTools::debugInfo(META_STRING("Truncated pipeline checkpoint!"));
+        return false;
+    }
+    snapshot = std::move(loaded);
+    return true;
+}
+
+bool TA_PipelineCheckpoint::remove(const std::string &path) {
+    std::error_code error;
+    return std::filesystem::remove(path, error);
+}
+} // namespace CoreAsync
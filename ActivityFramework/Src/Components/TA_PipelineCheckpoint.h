@@ -0,0 +1,81 @@
+/*
+ * Copyright [2025] [Shuang Zhu / Sol]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TA_PIPELINECHECKPOINT_H
+#define TA_PIPELINECHECKPOINT_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+#include "TA_Serialization.h"
+#include "TA_Variant.h"
+
+namespace CoreAsync {
+/*
+ * Persistent state of a manual chain pipeline. Results are written as a type tag followed by the value, so only
+ * result types registered through registerType() survive a round trip; any other result is restored as an invalid
+ * variant. Tags must be stable across builds because they are what a restarted process matches against.
+ */
+class ACTIVITY_FRAMEWORK_EXPORT TA_PipelineCheckpoint {
+  public:
+    using TypeTag = std::uint32_t;
+
+    struct Snapshot {
+        std::uint64_t activitySize{0};
+        std::uint64_t startIndex{0};
+        std::int64_t position{0};
+        std::vector<TA_DefaultVariant> results;
+    };
+
+    template <typename T> static bool registerType(TypeTag tag) {
+        using RawType = std::decay_t<T>;
+        return registerImpl(
+            typeid(RawType).hash_code(), tag,
+            [](TA_Serializer<BufferWriter> &output, const TA_DefaultVariant &var) {
+                output << var.template get<RawType>();
+            },
+            [](TA_Serializer<BufferReader> &input) {
+                RawType value{};
+                input >> value;
+                TA_DefaultVariant var;
+                var.set(std::move(value));
+                return var;
+            });
+    }
+
+    static bool isRegistered(std::size_t typeId);
+
+    // The snapshot is written next to the target and renamed over it, so a crash while saving leaves the previous
+    // checkpoint intact.
+    static bool save(const std::string &path, const Snapshot &snapshot);
+    static bool load(const std::string &path, Snapshot &snapshot);
+    static bool remove(const std::string &path);
+
+  private:
+    using Writer = std::function<void(TA_Serializer<BufferWriter> &, const TA_DefaultVariant &)>;
+    using Reader = std::function<TA_DefaultVariant(TA_Serializer<BufferReader> &)>;
+
+    static constexpr std::uint32_t magic{0x54414350};
+    static constexpr TypeTag invalidTag{0};
+
+    static bool registerImpl(std::size_t typeId, TypeTag tag, Writer writer, Reader reader);
+};
+} // namespace CoreAsync
+
+#endif // TA_PIPELINECHECKPOINT_H
@@ -32,40 +32,75 @@ TA_PipelineCreator::~TA_PipelineCreator() {
         value = nullptr;
     };
 
-    for (auto &pHolder : m_holderList) {
+    for (auto pHolder : m_liveHolders) {
         std::visit(deleteVistor, pHolder);
     }
+    for (auto &pool : m_pools) {
+        for (auto &pHolder : pool) {
+            std::visit(deleteVistor, pHolder);
+        }
+    }
 }
 
 TA_MainPipelineHolder<TA_PipelineHolder<TA_AutoChainPipeline>> *TA_PipelineCreator::createAutoChainPipeline() {
-    auto pHolder = new TA_PipelineHolder<TA_AutoChainPipeline>();
-    m_holderList.push_back(pHolder);
-    return pHolder;
+    return acquire<TA_AutoChainPipeline>();
 }
 
 TA_MainPipelineHolder<TA_PipelineHolder<TA_ConcurrentPipeline>> *TA_PipelineCreator::createConcurrentPipeline() {
-    auto pHolder = new TA_PipelineHolder<TA_ConcurrentPipeline>();
-    m_holderList.push_back(pHolder);
-    return pHolder;
+    return acquire<TA_ConcurrentPipeline>();
 }
 
 TA_MainPipelineHolder<TA_PipelineHolder<TA_ManualChainPipeline>> *TA_PipelineCreator::createManualChainPipeline() {
-    auto pHolder = new TA_PipelineHolder<TA_ManualChainPipeline>();
-    m_holderList.push_back(pHolder);
-    return pHolder;
+    return acquire<TA_ManualChainPipeline>();
 }
 
 TA_MainPipelineHolder<TA_PipelineHolder<TA_ManualStepsChainPipeline>> *
 TA_PipelineCreator::createManualStepsChainPipeline() {
-    auto pHolder = new TA_PipelineHolder<TA_ManualStepsChainPipeline>();
-    m_holderList.push_back(pHolder);
-    return pHolder;
+    return acquire<TA_ManualStepsChainPipeline>();
 }
 
 TA_MainPipelineHolder<TA_PipelineHolder<TA_ManualKeyActivityChainPipeline>> *
 TA_PipelineCreator::createManualKeyActivityChainPipeline() {
-    auto pHolder = new TA_PipelineHolder<TA_ManualKeyActivityChainPipeline>();
-    m_holderList.push_back(pHolder);
-    return pHolder;
+    return acquire<TA_ManualKeyActivityChainPipeline>();
+}
+
+TA_MainPipelineHolder<TA_PipelineHolder<TA_DagPipeline>> *TA_PipelineCreator::createDagPipeline() {
+    return acquire<TA_DagPipeline>();
+}
+
+void TA_PipelineCreator::setPoolCapacity(std::size_t capacity) {
+    std::vector<HolderVar> dropped;
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        m_poolCapacity = capacity;
+        for (auto &pool : m_pools) {
+            while (pool.size() > capacity) {
+                dropped.emplace_back(pool.back());
+                pool.pop_back();
+            }
+        }
+    }
+    for (auto &pHolder : dropped) {
+        std::visit([](auto &&value) { delete value; }, pHolder);
+    }
+}
+
+std::size_t TA_PipelineCreator::poolCapacity() const {
+    std::lock_guard<std::mutex> locker(m_mutex);
+    return m_poolCapacity;
+}
+
+std::size_t TA_PipelineCreator::liveCount() const {
+    std::lock_guard<std::mutex> locker(m_mutex);
+    return m_liveHolders.size();
+}
+
+std::size_t TA_PipelineCreator::pooledCount() const {
+    std::lock_guard<std::mutex> locker(m_mutex);
+    std::size_t count{0};
+    for (const auto &pool : m_pools) {
+        count += pool.size();
+    }
+    return count;
 }
 } // namespace CoreAsync
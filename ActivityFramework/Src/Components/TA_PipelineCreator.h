@@ -17,8 +17,12 @@
 #ifndef TA_PIPELINECREATOR_H
 #define TA_PIPELINECREATOR_H
 
-#include <list>
+#include <array>
+#include <cassert>
+#include <mutex>
+#include <unordered_set>
 #include <variant>
+#include <vector>
 
 #include "Components/TA_PipelineHolder.h"
 
@@ -30,6 +34,7 @@ class ACTIVITY_FRAMEWORK_EXPORT TA_PipelineCreator {
     using ConcurrentHolder = TA_MainPipelineHolder<TA_PipelineHolder<TA_ConcurrentPipeline>>;
     using ManualStepsChainHolder = TA_MainPipelineHolder<TA_PipelineHolder<TA_ManualStepsChainPipeline>>;
     using ManualKeyActivityChainHolder = TA_MainPipelineHolder<TA_PipelineHolder<TA_ManualKeyActivityChainPipeline>>;
+    using DagHolder = TA_MainPipelineHolder<TA_PipelineHolder<TA_DagPipeline>>;
 
     static TA_PipelineCreator &GetInstance();
 
@@ -45,15 +50,71 @@ class ACTIVITY_FRAMEWORK_EXPORT TA_PipelineCreator {
     ConcurrentHolder *createConcurrentPipeline();
     ManualStepsChainHolder *createManualStepsChainPipeline();
     ManualKeyActivityChainHolder *createManualKeyActivityChainPipeline();
+    DagHolder *createDagPipeline();
+
+    // Hands a holder back to the creator. The pipeline is recycled in place and kept in a free pool of its type for
+    // the next create call, or deleted when that pool is full. Connections made to the holder by the caller are not
+    // removed and have to be disconnected before the release.
+    template <typename Holder> bool release(Holder *pHolder) {
+        if (!pHolder) {
+            return false;
+        }
+        std::unique_lock<std::mutex> locker(m_mutex);
+        auto iter{m_liveHolders.find(HolderVar{pHolder})};
+        if (iter == m_liveHolders.end()) {
+            TA_CommonTools::debugInfo(META_STRING("Release unknown pipeline holder!"));
+            return false;
+        }
+        if (TA_BasicPipeline::State::Busy == pHolder->state()) {
+            assert(TA_BasicPipeline::State::Busy != pHolder->state());
+            TA_CommonTools::debugInfo(META_STRING("Release busy pipeline failed!"));
+            return false;
+        }
+        m_liveHolders.erase(iter);
+        auto &pool{m_pools[HolderVar{pHolder}.index()]};
+        if (pool.size() < m_poolCapacity) {
+            pHolder->m_pBasicPipeline->recycle();
+            pool.emplace_back(pHolder);
+            return true;
+        }
+        locker.unlock();
+        delete pHolder;
+        return true;
+    }
+
+    void setPoolCapacity(std::size_t capacity);
+    std::size_t poolCapacity() const;
+    std::size_t liveCount() const;
+    std::size_t pooledCount() const;
 
   private:
     TA_PipelineCreator();
 
+    template <typename Pip> TA_MainPipelineHolder<TA_PipelineHolder<Pip>> *acquire() {
+        using Holder = TA_MainPipelineHolder<TA_PipelineHolder<Pip>>;
+        Holder *pHolder{nullptr};
+        std::lock_guard<std::mutex> locker(m_mutex);
+        auto &pool{m_pools[HolderVar{pHolder}.index()]};
+        if (pool.empty()) {
+            pHolder = new TA_PipelineHolder<Pip>();
+        } else {
+            pHolder = std::get<Holder *>(pool.back());
+            pool.pop_back();
+        }
+        m_liveHolders.emplace(pHolder);
+        return pHolder;
+    }
+
   private:
     using HolderVar = std::variant<AutoChainHolder *, ManualChainHolder *, ConcurrentHolder *, ManualStepsChainHolder *,
-                                   ManualKeyActivityChainHolder *>;
+                                   ManualKeyActivityChainHolder *, DagHolder *>;
+
+    static constexpr std::size_t defaultPoolCapacity{16};
 
-    std::list<HolderVar> m_holderList;
+    mutable std::mutex m_mutex;
+    std::unordered_set<HolderVar> m_liveHolders;
+    std::array<std::vector<HolderVar>, std::variant_size_v<HolderVar>> m_pools;
+    std::size_t m_poolCapacity{defaultPoolCapacity};
 };
 } // namespace CoreAsync
 
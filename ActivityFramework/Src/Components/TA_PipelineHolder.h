@@ -22,16 +22,18 @@
 #include "TA_ConcurrentPipeline.h"
 #include "TA_ManualStepsChainPipeline.h"
 #include "TA_ManualKeyActivityChainPipeline.h"
+#include "TA_DagPipeline.h"
 #include "TA_TypeList.h"
 #include "TA_MetaReflex.h"
 
 namespace CoreAsync {
 
 using Pipelines = TA_MetaTypelist<TA_AutoChainPipeline, TA_ManualChainPipeline, TA_ConcurrentPipeline,
-                                  TA_ManualStepsChainPipeline, TA_ManualKeyActivityChainPipeline>;
+                                  TA_ManualStepsChainPipeline, TA_ManualKeyActivityChainPipeline, TA_DagPipeline>;
 
 template <typename Holder> class ACTIVITY_FRAMEWORK_EXPORT TA_MainPipelineHolder : public TA_MetaObject {
     friend class TA_PipelineCreator;
+    friend class TA_BasicPipeline;
 
   public:
     virtual ~TA_MainPipelineHolder() { destroy(); }
@@ -46,8 +48,18 @@ template <typename Holder> class ACTIVITY_FRAMEWORK_EXPORT TA_MainPipelineHolder
 
     bool remove(unsigned int index) { return m_pBasicPipeline->remove(index); }
 
+    void reserve(std::size_t size) { m_pBasicPipeline->reserve(size); }
+
     void setStartIndex(unsigned int index) { m_pBasicPipeline->setStartIndex(index); }
 
+    void setStagePolicy(unsigned int index, TA_BasicPipeline::StagePolicy policy) {
+        m_pBasicPipeline->setStagePolicy(index, policy);
+    }
+
+    void setProfilingEnabled(bool enabled) { m_pBasicPipeline->setProfilingEnabled(enabled); }
+
+    std::shared_ptr<const TA_PipelineProfile> profile() const { return m_pBasicPipeline->profile(); }
+
     std::size_t activitySize() const { return m_pBasicPipeline->activitySize(); }
 
     void receivePipelineState(TA_BasicPipeline::State st) {
@@ -72,6 +84,36 @@ template <typename Holder> class ACTIVITY_FRAMEWORK_EXPORT TA_MainPipelineHolder
 
     void skipKeyActivity() { static_cast<Holder *>(this)->skipKeyActivity(); }
 
+    bool setPredecessors(unsigned int index, const std::vector<unsigned int> &predecessors) {
+        return static_cast<Holder *>(this)->setPredecessors(index, predecessors);
+    }
+
+    bool setCost(unsigned int index, std::size_t cost) { return static_cast<Holder *>(this)->setCost(index, cost); }
+
+    template <typename Fn> unsigned int addNode(Fn fn, const std::vector<unsigned int> &predecessors = {}) {
+        return static_cast<Holder *>(this)->addNode(std::move(fn), predecessors);
+    }
+
+    std::shared_ptr<TA_PipelineInstance> createInstance(TA_DefaultVariant input = {}) {
+        return static_cast<Holder *>(this)->createInstance(std::move(input));
+    }
+
+    void setCheckpoint(const std::string &path, unsigned int interval = 1) {
+        static_cast<Holder *>(this)->setCheckpoint(path, interval);
+    }
+
+    bool resume(const std::string &path) { return static_cast<Holder *>(this)->resume(path); }
+
+    void setMaxInFlight(std::size_t count) { static_cast<Holder *>(this)->setMaxInFlight(count); }
+
+    void setReducer(TA_ConcurrentPipeline::Reducer reducer, TA_DefaultVariant init = {}, bool keepResults = false) {
+        static_cast<Holder *>(this)->setReducer(std::move(reducer), std::move(init), keepResults);
+    }
+
+    template <typename Res> bool reducedResult(Res &res) {
+        return static_cast<Holder *>(this)->template reducedResult<Res>(res);
+    }
+
   protected:
     template <typename Pip> Pip *raw() const {
         Pip *pObj = dynamic_cast<Pip *>(m_pBasicPipeline);
@@ -134,6 +176,60 @@ class ACTIVITY_FRAMEWORK_EXPORT TA_PipelineHolder : public TA_MainPipelineHolder
         m_pPipeline->skipKeyActivity();
     }
 
+    bool setPredecessors(unsigned int index, const std::vector<unsigned int> &predecessors) {
+        static_assert(std::is_same_v<std::decay_t<Pip>, TA_DagPipeline>,
+                      "This kind of pipeline doesn't support predecessors setting.");
+        return m_pPipeline->setPredecessors(index, predecessors);
+    }
+
+    bool setCost(unsigned int index, std::size_t cost) {
+        static_assert(std::is_same_v<std::decay_t<Pip>, TA_DagPipeline>,
+                      "This kind of pipeline doesn't support cost setting.");
+        return m_pPipeline->setCost(index, cost);
+    }
+
+    template <typename Fn> unsigned int addNode(Fn fn, const std::vector<unsigned int> &predecessors = {}) {
+        static_assert(std::is_same_v<std::decay_t<Pip>, TA_DagPipeline>,
+                      "This kind of pipeline doesn't support adding nodes.");
+        return m_pPipeline->addNode(std::move(fn), predecessors);
+    }
+
+    std::shared_ptr<TA_PipelineInstance> createInstance(TA_DefaultVariant input = {}) {
+        static_assert(std::is_same_v<std::decay_t<Pip>, TA_AutoChainPipeline>,
+                      "This kind of pipeline doesn't support instances.");
+        return m_pPipeline->createInstance(std::move(input));
+    }
+
+    void setCheckpoint(const std::string &path, unsigned int interval = 1) {
+        static_assert(std::is_base_of_v<TA_ManualChainPipeline, std::decay_t<Pip>>,
+                      "This kind of pipeline doesn't support checkpoints.");
+        m_pPipeline->setCheckpoint(path, interval);
+    }
+
+    bool resume(const std::string &path) {
+        static_assert(std::is_base_of_v<TA_ManualChainPipeline, std::decay_t<Pip>>,
+                      "This kind of pipeline doesn't support checkpoints.");
+        return m_pPipeline->resume(path);
+    }
+
+    void setMaxInFlight(std::size_t count) {
+        static_assert(std::is_same_v<std::decay_t<Pip>, TA_ConcurrentPipeline>,
+                      "This kind of pipeline doesn't support in-flight limit setting.");
+        m_pPipeline->setMaxInFlight(count);
+    }
+
+    void setReducer(TA_ConcurrentPipeline::Reducer reducer, TA_DefaultVariant init = {}, bool keepResults = false) {
+        static_assert(std::is_same_v<std::decay_t<Pip>, TA_ConcurrentPipeline>,
+                      "This kind of pipeline doesn't support reducer setting.");
+        m_pPipeline->setReducer(std::move(reducer), std::move(init), keepResults);
+    }
+
+    template <typename Res> bool reducedResult(Res &res) {
+        static_assert(std::is_same_v<std::decay_t<Pip>, TA_ConcurrentPipeline>,
+                      "This kind of pipeline doesn't support reduced result.");
+        return m_pPipeline->template reducedResult<Res>(res);
+    }
+
     void destroy() {
         if (m_pPipeline) {
             delete m_pPipeline;
@@ -184,6 +280,7 @@ struct ACTIVITY_FRAMEWORK_EXPORT TA_TypeInfo<TA_MainPipelineHolder<TA_PipelineHo
         TA_MetaField{&Raw::activitySize, META_STRING("activitySize")},
         TA_MetaField{&Raw::state, META_STRING("state")},
         TA_MetaField{&Raw::receivePipelineState, META_STRING("receivePipelineState")},
+        TA_MetaField{&Raw::setMaxInFlight, META_STRING("setMaxInFlight")},
         TA_MetaField{&Raw::pipelineStateChanged, META_STRING("pipelineStateChanged")},
         TA_MetaField{&Raw::pipelineReady, META_STRING("pipelineReady")},
         TA_MetaField{&Raw::activityCompleted, META_STRING("activityCompleted")}};
@@ -195,6 +292,7 @@ struct ACTIVITY_FRAMEWORK_EXPORT TA_TypeInfo<TA_PipelineHolder<TA_ConcurrentPipe
                       TA_MainPipelineHolder<TA_PipelineHolder<TA_ConcurrentPipeline>>> {
     static constexpr TA_MetaFieldList fields = {
         TA_MetaField{&Raw::destroy, META_STRING("destroy")},
+        TA_MetaField{&Raw::setMaxInFlight, META_STRING("setMaxInFlight")},
     };
 };
 
@@ -279,6 +377,34 @@ struct ACTIVITY_FRAMEWORK_EXPORT TA_TypeInfo<TA_PipelineHolder<TA_ManualKeyActiv
         TA_MetaField{&Raw::setKeyActivityIndex, META_STRING("setKeyActivityIndex")},
         TA_MetaField{&Raw::skipKeyActivity, META_STRING("skipKeyActivity")}};
 };
+
+template <>
+struct ACTIVITY_FRAMEWORK_EXPORT TA_TypeInfo<TA_MainPipelineHolder<TA_PipelineHolder<TA_DagPipeline>>>
+    : TA_MetaTypeInfo<TA_MainPipelineHolder<TA_PipelineHolder<TA_DagPipeline>>> {
+    static constexpr TA_MetaFieldList fields = {
+        TA_MetaField{&Raw::setStartIndex, META_STRING("setStartIndex")},
+        TA_MetaField{&Raw::remove, META_STRING("remove")},
+        TA_MetaField{&Raw::clear, META_STRING("clear")},
+        TA_MetaField{&Raw::execute, META_STRING("execute")},
+        TA_MetaField{&Raw::reset, META_STRING("reset")},
+        TA_MetaField{&Raw::activitySize, META_STRING("activitySize")},
+        TA_MetaField{&Raw::state, META_STRING("state")},
+        TA_MetaField{&Raw::receivePipelineState, META_STRING("receivePipelineState")},
+        TA_MetaField{&Raw::setPredecessors, META_STRING("setPredecessors")},
+        TA_MetaField{&Raw::setCost, META_STRING("setCost")},
+        TA_MetaField{&Raw::pipelineStateChanged, META_STRING("pipelineStateChanged")},
+        TA_MetaField{&Raw::pipelineReady, META_STRING("pipelineReady")},
+        TA_MetaField{&Raw::activityCompleted, META_STRING("activityCompleted")}};
+};
+
+template <>
+struct ACTIVITY_FRAMEWORK_EXPORT TA_TypeInfo<TA_PipelineHolder<TA_DagPipeline>>
+    : TA_MetaTypeInfo<TA_PipelineHolder<TA_DagPipeline>, TA_MainPipelineHolder<TA_PipelineHolder<TA_DagPipeline>>> {
+    static constexpr TA_MetaFieldList fields = {
+        TA_MetaField{&Raw::destroy, META_STRING("destroy")},
+        TA_MetaField{&Raw::setPredecessors, META_STRING("setPredecessors")},
+        TA_MetaField{&Raw::setCost, META_STRING("setCost")}};
+};
 } // namespace Reflex
 } // namespace CoreAsync
 
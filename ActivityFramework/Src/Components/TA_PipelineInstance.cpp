@@ -0,0 +1,87 @@
+/*
+ * Copyright [2025] [Shuang Zhu / Sol]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Components/TA_PipelineInstance.h"
+#include "Components/TA_CommonTools.h"
+
+namespace CoreAsync {
+namespace {
+thread_local TA_PipelineInstance *t_pCurrentInstance{nullptr};
+}
+
+std::shared_ptr<TA_PipelineInstance> TA_PipelineInstance::create(std::shared_ptr<const Definition> pDefinition,
+                                                                 TA_DefaultVariant input) {
+    if (!pDefinition) {
+        throw std::invalid_argument("Pipeline definition is null");
+    }
+    return std::shared_ptr<TA_PipelineInstance>(new TA_PipelineInstance(std::move(pDefinition), std::move(input)));
+}
+
+TA_PipelineInstance *TA_PipelineInstance::current() { return t_pCurrentInstance; }
+
+TA_PipelineInstance::TA_PipelineInstance(std::shared_ptr<const Definition> pDefinition, TA_DefaultVariant input)
+    : m_pDefinition(std::move(pDefinition)), m_input(std::move(input)), m_results(m_pDefinition->size()) {}
+
+bool TA_PipelineInstance::execute(TA_BasicPipeline::ExecuteType type) {
+    bool expected{false};
+    if (!m_started.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+        assert(!expected);
+        TA_CommonTools::debugInfo(META_STRING("Execute pipeline instance failed!"));
+        return false;
+    }
+    if (type == TA_BasicPipeline::ExecuteType::Sync) {
+        proceed(0);
+        return true;
+    }
+    auto pActivity = TA_ActivityCreator::create([pSelf = shared_from_this()]() { pSelf->proceed(0); });
+    [[maybe_unused]] auto fetcher = TA_ThreadHolder::get().postActivity(pActivity, true);
+    return true;
+}
+
+void TA_PipelineInstance::proceed(std::size_t from) {
+    // Restores the instance of an enclosing run, e.g. a synchronous instance executed from inside another stage.
+    struct CurrentGuard {
+        TA_PipelineInstance *pOuter{t_pCurrentInstance};
+        ~CurrentGuard() { t_pCurrentInstance = pOuter; }
+    } guard;
+    t_pCurrentInstance = this;
+    for (auto idx = from; idx < m_pDefinition->size(); ++idx) {
+        m_stage = idx;
+        TA_DefaultVariant var;
+        try {
+            var = (*m_pDefinition)[idx]->invoke();
+        } catch (...) {
+            TA_CommonTools::debugInfo(META_STRING("Pipeline instance stage %d threw an exception!"), idx);
+            m_exception = std::current_exception();
+            break;
+        }
+        if (var.isSameType<TA_BasicPipeline::SuspendableStage>()) {
+            auto stage{var.get<TA_BasicPipeline::SuspendableStage>()};
+            stage.start([pSelf = shared_from_this(), stage, idx]() {
+                if (stage.exception()) {
+                    TA_CommonTools::debugInfo(META_STRING("Suspendable stage %d threw an exception!"), idx);
+                }
+                pSelf->m_results[idx] = stage.result().value_or(TA_DefaultVariant{});
+                pSelf->proceed(idx + 1);
+            });
+            return;
+        }
+        m_results[idx] = std::move(var);
+    }
+    m_done.store(true, std::memory_order_release);
+    m_done.notify_all();
+}
+} // namespace CoreAsync
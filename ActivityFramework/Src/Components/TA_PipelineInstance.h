@@ -0,0 +1,93 @@
+/*
+ * Copyright [2025] [Shuang Zhu / Sol]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TA_PIPELINEINSTANCE_H
+#define TA_PIPELINEINSTANCE_H
+
+#include "TA_BasicPipeline.h"
+
+namespace CoreAsync {
+/*
+ * One run of a chain pipeline definition. The definition is an immutable snapshot of the stages and is shared by any
+ * number of instances, each of which owns its input and result slots and runs without the pipeline's state machine
+ * or mutex, so runs over different inputs overlap freely. Stages read the input of the instance they run for through
+ * TA_PipelineInstance::current().
+ */
+class ACTIVITY_FRAMEWORK_EXPORT TA_PipelineInstance : public std::enable_shared_from_this<TA_PipelineInstance> {
+  public:
+    using Definition = std::vector<std::shared_ptr<TA_ActivityProxy>>;
+
+    static std::shared_ptr<TA_PipelineInstance> create(std::shared_ptr<const Definition> pDefinition,
+                                                       TA_DefaultVariant input = {});
+
+    // The instance whose stage runs on the calling thread, nullptr outside of an instance run. Only valid while a stage
+    // runs synchronously: a suspendable stage must read what it needs before its first suspension, since it may resume
+    // on a thread that runs another instance or none at all.
+    static TA_PipelineInstance *current();
+
+    TA_PipelineInstance(const TA_PipelineInstance &instance) = delete;
+    TA_PipelineInstance(TA_PipelineInstance &&instance) = delete;
+    TA_PipelineInstance &operator=(const TA_PipelineInstance &) = delete;
+
+    bool execute(TA_BasicPipeline::ExecuteType type = TA_BasicPipeline::ExecuteType::Async);
+
+    void wait() const { m_done.wait(false, std::memory_order_acquire); }
+
+    bool isDone() const { return m_done.load(std::memory_order_acquire); }
+
+    // The exception thrown by the stage the run stopped at, nullptr if every stage ran. Valid once the run is done.
+    std::exception_ptr exception() const { return isDone() ? m_exception : nullptr; }
+
+    // The stage that ran last, or the one that threw.
+    std::size_t stage() const { return m_stage; }
+
+    const TA_DefaultVariant &input() const { return m_input; }
+
+    // Result of the stage before the running one, or the input while the first stage runs.
+    const TA_DefaultVariant &previous() const { return m_stage == 0 ? m_input : m_results[m_stage - 1]; }
+
+    std::size_t stageSize() const { return m_pDefinition->size(); }
+
+    template <typename Res> bool result(std::size_t index, Res &res) const {
+        if (!isDone()) {
+            TA_CommonTools::debugInfo(META_STRING("Get result from pipeline instance failed!"));
+            assert(isDone());
+            return false;
+        }
+        if (index < m_results.size()) {
+            res = m_results[index].template get<Res>();
+            return true;
+        }
+        return false;
+    }
+
+  private:
+    TA_PipelineInstance(std::shared_ptr<const Definition> pDefinition, TA_DefaultVariant input);
+
+    void proceed(std::size_t from);
+
+  private:
+    std::shared_ptr<const Definition> m_pDefinition;
+    const TA_DefaultVariant m_input;
+    std::vector<TA_DefaultVariant> m_results;
+    std::size_t m_stage{0};
+    std::exception_ptr m_exception{nullptr};
+    std::atomic_bool m_started{false};
+    std::atomic_bool m_done{false};
+};
+} // namespace CoreAsync
+
+#endif // TA_PIPELINEINSTANCE_H
@@ -0,0 +1,150 @@
+/*
+ * Copyright [2025] [Shuang Zhu / Sol]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Components/TA_PipelineProfile.h"
+
+#include <algorithm>
+
+namespace CoreAsync {
+std::vector<TA_PipelineProfile::RunRecord> TA_PipelineProfile::runs() const {
+    std::lock_guard<std::mutex> locker(m_mutex);
+    return {m_runs.begin(), m_runs.end()};
+}
+
+TA_PipelineProfile::Report TA_PipelineProfile::report() const {
+    std::lock_guard<std::mutex> locker(m_mutex);
+    Report report;
+    report.runs = m_runs.size();
+    std::vector<std::vector<std::chrono::nanoseconds>> executions;
+    std::vector<std::chrono::nanoseconds> queueWaits;
+    for (const auto &run : m_runs) {
+        if (executions.size() < run.stages.size()) {
+            executions.resize(run.stages.size());
+            queueWaits.resize(run.stages.size());
+        }
+        for (std::size_t idx = 0; idx < run.stages.size(); ++idx) {
+            const auto &stage{run.stages[idx]};
+            if (stage.isFinished()) {
+                executions[idx].emplace_back(stage.finish - stage.start);
+                queueWaits[idx] += stage.start - stage.enqueue;
+            }
+        }
+    }
+    for (std::size_t idx = 0; idx < executions.size(); ++idx) {
+        auto &samples{executions[idx]};
+        if (samples.empty()) {
+            continue;
+        }
+        StageSummary summary;
+        summary.index = static_cast<StageIndex>(idx);
+        summary.samples = samples.size();
+        std::sort(samples.begin(), samples.end());
+        summary.minExecution = samples.front();
+        for (auto sample : samples) {
+            summary.avgExecution += sample;
+        }
+        summary.avgExecution /= samples.size();
+        summary.p99Execution = samples[(samples.size() * 99 + 99) / 100 - 1];
+        summary.avgQueueWait = queueWaits[idx] / samples.size();
+        report.stages.emplace_back(summary);
+    }
+    if (m_runs.empty()) {
+        return report;
+    }
+    // Walk back from the stage that finished last, always through the predecessor that released it last.
+    const auto &stages{m_runs.back().stages};
+    auto latest = [&stages](auto first, auto last) {
+        std::size_t found{stages.size()};
+        for (; first != last; ++first) {
+            const std::size_t idx{*first};
+            if (idx < stages.size() && stages[idx].isFinished() &&
+                (found == stages.size() || stages[found].finish < stages[idx].finish)) {
+                found = idx;
+            }
+        }
+        return found;
+    };
+    std::vector<StageIndex> all(stages.size());
+    for (std::size_t idx = 0; idx < all.size(); ++idx) {
+        all[idx] = static_cast<StageIndex>(idx);
+    }
+    std::size_t current{latest(all.begin(), all.end())};
+    while (current < stages.size()) {
+        report.criticalPath.emplace_back(static_cast<StageIndex>(current));
+        if (current >= m_dependencies.size()) {
+            break;
+        }
+        current = latest(m_dependencies[current].begin(), m_dependencies[current].end());
+    }
+    std::reverse(report.criticalPath.begin(), report.criticalPath.end());
+    if (!report.criticalPath.empty()) {
+        report.criticalPathTime =
+            stages[report.criticalPath.back()].finish - stages[report.criticalPath.front()].enqueue;
+    }
+    return report;
+}
+
+void TA_PipelineProfile::clear() {
+    std::lock_guard<std::mutex> locker(m_mutex);
+    m_runs.clear();
+}
+
+void TA_PipelineProfile::beginRun(std::vector<std::vector<StageIndex>> dependencies) {
+    std::lock_guard<std::mutex> locker(m_mutex);
+    m_current = RunRecord{Clock::now(), {}, {}, std::vector<StageRecord>(dependencies.size())};
+    m_dependencies = std::move(dependencies);
+    m_isRunning = true;
+}
+
+void TA_PipelineProfile::runStarted() {
+    std::lock_guard<std::mutex> locker(m_mutex);
+    m_current.start = Clock::now();
+}
+
+void TA_PipelineProfile::endRun() {
+    std::lock_guard<std::mutex> locker(m_mutex);
+    if (!m_isRunning) {
+        return;
+    }
+    m_isRunning = false;
+    m_current.finish = Clock::now();
+    if (m_runs.size() == maxRuns) {
+        m_runs.pop_front();
+    }
+    m_runs.emplace_back(std::move(m_current));
+}
+
+void TA_PipelineProfile::stageEnqueued(StageIndex index) {
+    updateStage(index, [now = Clock::now()](StageRecord &stage) { stage.enqueue = now; });
+}
+
+void TA_PipelineProfile::chainStageEnqueued(StageIndex index) {
+    std::lock_guard<std::mutex> locker(m_mutex);
+    if (!m_isRunning || index >= m_current.stages.size()) {
+        return;
+    }
+    const bool afterPrevious{index > 0 && m_current.stages[index - 1].isFinished()};
+    m_current.stages[index].enqueue = afterPrevious ? m_current.stages[index - 1].finish : m_current.enqueue;
+}
+
+void TA_PipelineProfile::stageStarted(StageIndex index) {
+    updateStage(index, [now = Clock::now()](StageRecord &stage) { stage.start = now; });
+}
+
+void TA_PipelineProfile::stageFinished(StageIndex index) {
+    updateStage(index, [now = Clock::now()](StageRecord &stage) { stage.finish = now; });
+}
+} // namespace CoreAsync
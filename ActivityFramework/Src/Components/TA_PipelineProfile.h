@@ -0,0 +1,97 @@
+/*
+ * Copyright [2025] [Shuang Zhu / Sol]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TA_PIPELINEPROFILE_H
+#define TA_PIPELINEPROFILE_H
+
+#include "TA_ActivityFramework_global.h"
+
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace CoreAsync {
+/*
+ * Timestamps of the recent runs of one pipeline. A run is enqueued by execute(), starts when the runner activity is
+ * picked up by a worker and finishes when the pipeline leaves the busy state. A stage is enqueued when it becomes
+ * runnable, so the gap to its start is the time it spent waiting for a worker. Chain stages run one after the other on
+ * the runner, so a chain stage becomes runnable when the stage before it finishes, the first one when the run is
+ * enqueued. A suspendable stage finishes when its coroutine completes, not when it hands out the coroutine.
+ */
+class ACTIVITY_FRAMEWORK_EXPORT TA_PipelineProfile {
+  public:
+    using Clock = std::chrono::steady_clock;
+    using StageIndex = unsigned int;
+
+    static constexpr std::size_t maxRuns{256};
+
+    struct StageRecord {
+        Clock::time_point enqueue{}, start{}, finish{};
+
+        bool isFinished() const { return finish != Clock::time_point{}; }
+    };
+
+    struct RunRecord {
+        Clock::time_point enqueue{}, start{}, finish{};
+        std::vector<StageRecord> stages;
+    };
+
+    struct StageSummary {
+        StageIndex index{0};
+        std::size_t samples{0};
+        std::chrono::nanoseconds minExecution{0}, avgExecution{0}, p99Execution{0};
+        std::chrono::nanoseconds avgQueueWait{0};
+    };
+
+    struct Report {
+        std::size_t runs{0};
+        std::vector<StageSummary> stages;
+        // Stages of the latest run that gated its finish, from the first to the last one.
+        std::vector<StageIndex> criticalPath;
+        std::chrono::nanoseconds criticalPathTime{0};
+    };
+
+    std::vector<RunRecord> runs() const;
+    Report report() const;
+    void clear();
+
+    void beginRun(std::vector<std::vector<StageIndex>> dependencies);
+    void runStarted();
+    void endRun();
+    void stageEnqueued(StageIndex index);
+    void chainStageEnqueued(StageIndex index);
+    void stageStarted(StageIndex index);
+    void stageFinished(StageIndex index);
+
+  private:
+    template <typename Fn> void updateStage(StageIndex index, Fn &&fn) {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        if (m_isRunning && index < m_current.stages.size()) {
+            fn(m_current.stages[index]);
+        }
+    }
+
+  private:
+    mutable std::mutex m_mutex;
+    bool m_isRunning{false};
+    RunRecord m_current;
+    std::vector<std::vector<StageIndex>> m_dependencies;
+    std::deque<RunRecord> m_runs;
+};
+} // namespace CoreAsync
+
+#endif // TA_PIPELINEPROFILE_H
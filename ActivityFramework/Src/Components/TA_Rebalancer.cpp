@@ -0,0 +1,216 @@
+/*
+ * Copyright [2025] [Shuang Zhu / Sol]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Components/TA_Rebalancer.h"
+#include "Components/TA_MetaObject.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace CoreAsync {
+TA_Rebalancer &TA_Rebalancer::get() {
+    static TA_Rebalancer rebalancer;
+    return rebalancer;
+}
+
+TA_Rebalancer::~TA_Rebalancer() { stop(); }
+
+bool TA_Rebalancer::track(const std::shared_ptr<TA_MetaObject> &pObject) {
+    if (!pObject) {
+        return false;
+    }
+    std::lock_guard<std::mutex> locker(m_mutex);
+    std::erase_if(m_entries, [](const Entry &entry) { return entry.wpObject.expired(); });
+    if (std::ranges::any_of(m_entries, [&pObject](const Entry &entry) { return entry.pObject == pObject.get(); })) {
+        return false;
+    }
+    pObject->takeSlotLoad();
+    pObject->setSlotLoadSampled(true);
+    m_entries.emplace_back(Entry{pObject, pObject.get(), 0.0, 0, pObject->affinityThread(), 0, false});
+    return true;
+}
+
+bool TA_Rebalancer::untrack(TA_MetaObject *pObject) {
+    std::lock_guard<std::mutex> locker(m_mutex);
+    auto iter = std::ranges::find_if(m_entries, [pObject](const Entry &entry) { return entry.pObject == pObject; });
+    if (iter == m_entries.end()) {
+        return false;
+    }
+    if (auto pTracked = iter->wpObject.lock()) {
+        pTracked->setSlotLoadSampled(false);
+    }
+    m_entries.erase(iter);
+    return true;
+}
+
+std::size_t TA_Rebalancer::trackedCount() const {
+    std::lock_guard<std::mutex> locker(m_mutex);
+    return std::ranges::count_if(m_entries, [](const Entry &entry) { return !entry.wpObject.expired(); });
+}
+
+void TA_Rebalancer::setOptions(const TA_RebalancerOptions &options) {
+    std::lock_guard<std::mutex> locker(m_mutex);
+    m_options = options;
+    m_options.smoothing = std::clamp(m_options.smoothing, 0.0, 1.0);
+}
+
+TA_RebalancerOptions TA_Rebalancer::options() const {
+    std::lock_guard<std::mutex> locker(m_mutex);
+    return m_options;
+}
+
+bool TA_Rebalancer::rebalance() {
+    std::lock_guard<std::mutex> passLocker(m_passMutex);
+    const std::size_t threadSize{TA_ThreadHolder::get().size()};
+    std::shared_ptr<TA_MetaObject> pCandidate{nullptr};
+    Decision decision{};
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        ++m_pass;
+        ++m_metrics.passes;
+        std::erase_if(m_entries, [](const Entry &entry) { return entry.wpObject.expired(); });
+        std::vector<double> loads(threadSize, 0.0);
+        for (auto &entry : m_entries) {
+            auto pObject = entry.wpObject.lock();
+            if (!pObject) {
+                continue;
+            }
+            const auto sample = pObject->takeSlotLoad();
+            entry.load = m_options.smoothing * entry.load +
+                         (1.0 - m_options.smoothing) * static_cast<double>(sample.busyTime.count());
+            entry.messages = sample.messages;
+            entry.thread = pObject->affinityThread();
+            if (entry.thread < threadSize) {
+                loads[entry.thread] += entry.load;
+            }
+        }
+        m_metrics.threadLoads.clear();
+        for (double load : loads) {
+            m_metrics.threadLoads.emplace_back(static_cast<std::int64_t>(load));
+        }
+        if (threadSize < 2) {
+            return false;
+        }
+        const std::size_t from = std::ranges::max_element(loads) - loads.begin();
+        const std::size_t to = std::ranges::min_element(loads) - loads.begin();
+        if (loads[from] < static_cast<double>(m_options.minLoad.count()) ||
+            loads[from] < m_options.skewRatio * loads[to]) {
+            return false;
+        }
+        ++m_metrics.skewedPasses;
+        // Moving a load L leaves the two workers |gap - 2L| apart, so only 0 < L < gap narrows the gap.
+        const double gap{loads[from] - loads[to]};
+        double bestDistance{gap / 2};
+        Entry *pBest{nullptr};
+        for (auto &entry : m_entries) {
+            if (entry.thread != from || entry.load <= 0.0) {
+                continue;
+            }
+            const double distance{std::abs(entry.load - gap / 2)};
+            if (distance >= bestDistance) {
+                continue;
+            }
+            if (entry.moved && m_pass - entry.movedPass < m_options.cooldown) {
+                ++m_metrics.skippedCooldown;
+                continue;
+            }
+            auto pObject = entry.wpObject.lock();
+            if (!pObject || !pObject->isIdle() || pObject->hasQueuedCalls()) {
+                ++m_metrics.skippedBusy;
+                continue;
+            }
+            bestDistance = distance;
+            pBest = &entry;
+            pCandidate = std::move(pObject);
+        }
+        if (!pBest) {
+            ++m_metrics.noCandidate;
+            return false;
+        }
+        pBest->moved = true;
+        pBest->movedPass = m_pass;
+        decision = Decision{m_pass,
+                            from,
+                            to,
+                            std::chrono::nanoseconds{static_cast<std::int64_t>(pBest->load)},
+                            std::chrono::nanoseconds{static_cast<std::int64_t>(loads[from])},
+                            std::chrono::nanoseconds{static_cast<std::int64_t>(loads[to])},
+                            pBest->messages,
+                            false};
+    }
+    decision.migrated = pCandidate->tryMoveToThread(decision.to);
+    std::lock_guard<std::mutex> locker(m_mutex);
+    if (decision.migrated) {
+        ++m_metrics.migrations;
+    }
+    m_decisions.emplace_back(decision);
+    if (m_decisions.size() > maxDecisions) {
+        m_decisions.pop_front();
+    }
+    return decision.migrated;
+}
+
+bool TA_Rebalancer::start(std::chrono::milliseconds period) {
+    std::lock_guard<std::mutex> locker(m_runMutex);
+    if (m_runner.joinable()) {
+        return false;
+    }
+    m_stopRequested = false;
+    m_runner = std::thread([this, period]() {
+        std::unique_lock<std::mutex> runLocker(m_runMutex);
+        while (!m_wakeup.wait_for(runLocker, period, [this]() { return m_stopRequested; })) {
+            runLocker.unlock();
+            rebalance();
+            runLocker.lock();
+        }
+    });
+    return true;
+}
+
+void TA_Rebalancer::stop() {
+    std::thread runner;
+    {
+        std::lock_guard<std::mutex> locker(m_runMutex);
+        m_stopRequested = true;
+        runner = std::move(m_runner);
+    }
+    m_wakeup.notify_all();
+    if (runner.joinable()) {
+        runner.join();
+    }
+}
+
+bool TA_Rebalancer::isRunning() const {
+    std::lock_guard<std::mutex> locker(m_runMutex);
+    return m_runner.joinable();
+}
+
+TA_Rebalancer::Metrics TA_Rebalancer::metrics() const {
+    std::lock_guard<std::mutex> locker(m_mutex);
+    return m_metrics;
+}
+
+std::vector<TA_Rebalancer::Decision> TA_Rebalancer::decisions() const {
+    std::lock_guard<std::mutex> locker(m_mutex);
+    return {m_decisions.begin(), m_decisions.end()};
+}
+
+void TA_Rebalancer::resetMetrics() {
+    std::lock_guard<std::mutex> locker(m_mutex);
+    m_metrics = Metrics{};
+    m_decisions.clear();
+}
+} // namespace CoreAsync
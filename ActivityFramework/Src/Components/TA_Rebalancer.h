@@ -0,0 +1,142 @@
+/*
+ * Copyright [2025] [Shuang Zhu / Sol]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TA_REBALANCER_H
+#define TA_REBALANCER_H
+
+#include "TA_ActivityFramework_global.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace CoreAsync {
+class TA_MetaObject;
+
+struct TA_RebalancerOptions {
+    // Smoothed load of the busiest worker over the one of the least busy worker above which a pass moves an object.
+    double skewRatio{1.5};
+    // Load the busiest worker needs at least, below it the workers are considered equally idle.
+    std::chrono::nanoseconds minLoad{std::chrono::microseconds{500}};
+    // Passes a moved object stays on its new worker.
+    std::size_t cooldown{4};
+    // Weight of the earlier passes in the smoothed load of an object, between 0 and 1.
+    double smoothing{0.5};
+};
+
+/*
+ * Moves tracked objects away from overloaded workers. While an object is tracked, its connections measure the time
+ * spent in its slots and count the calls. Each pass turns these samples into a smoothed load per object and per
+ * worker. If the busiest worker is skewed against the least busy one, a single idle object is moved with
+ * tryMoveToThread(), the one whose load is closest to half of the gap. Objects that would carry the whole gap or more stay
+ * where they are, moving them would only move the hot spot. Together with the skew threshold and the cooldown of moved
+ * objects this keeps objects from bouncing between workers.
+ *
+ * Only tracked objects count towards the load of a worker. An object only moves while none of its queued slot calls
+ * is in flight, so its slots never run on the old and the new worker at once. A move that finds calls queued in the
+ * meantime is refused and shows up as a decision that didn't migrate.
+ */
+class ACTIVITY_FRAMEWORK_EXPORT TA_Rebalancer {
+  public:
+    struct Decision {
+        std::uint64_t pass{0};
+        std::size_t from{0}, to{0};
+        std::chrono::nanoseconds objectLoad{0}, fromLoad{0}, toLoad{0};
+        // Slot calls of the object during the pass.
+        std::uint64_t messages{0};
+        // False if tryMoveToThread() refused the move, e.g. because calls were queued for the object meanwhile.
+        bool migrated{false};
+    };
+
+    struct Metrics {
+        std::uint64_t passes{0};
+        std::uint64_t skewedPasses{0};
+        std::uint64_t migrations{0};
+        // Better candidates that were passed over because they were busy or had been moved recently.
+        std::uint64_t skippedBusy{0};
+        std::uint64_t skippedCooldown{0};
+        // Skewed passes without any object whose move would narrow the gap.
+        std::uint64_t noCandidate{0};
+        // Smoothed load per worker as of the latest pass.
+        std::vector<std::chrono::nanoseconds> threadLoads;
+    };
+
+    static constexpr std::size_t maxDecisions{64};
+
+    static TA_Rebalancer &get();
+
+    TA_Rebalancer(const TA_Rebalancer &rebalancer) = delete;
+    TA_Rebalancer &operator=(const TA_Rebalancer &rebalancer) = delete;
+
+    // Only objects owned by a shared_ptr can be tracked. An object is untracked when it is destroyed.
+    bool track(const std::shared_ptr<TA_MetaObject> &pObject);
+    bool untrack(TA_MetaObject *pObject);
+    std::size_t trackedCount() const;
+
+    void setOptions(const TA_RebalancerOptions &options);
+    TA_RebalancerOptions options() const;
+
+    // Runs one pass and returns true if an object was moved. It waits for the move, so it must not be called by a
+    // worker of the pool.
+    bool rebalance();
+
+    // Runs a pass every period on a thread of its own.
+    bool start(std::chrono::milliseconds period);
+    void stop();
+    bool isRunning() const;
+
+    Metrics metrics() const;
+    std::vector<Decision> decisions() const;
+    void resetMetrics();
+
+  private:
+    struct Entry {
+        std::weak_ptr<TA_MetaObject> wpObject;
+        TA_MetaObject *pObject{nullptr};
+        double load{0.0};
+        std::uint64_t messages{0};
+        std::size_t thread{0};
+        std::uint64_t movedPass{0};
+        bool moved{false};
+    };
+
+    TA_Rebalancer() = default;
+    ~TA_Rebalancer();
+
+  private:
+    mutable std::mutex m_mutex;
+    std::vector<Entry> m_entries;
+    TA_RebalancerOptions m_options{};
+    Metrics m_metrics{};
+    std::deque<Decision> m_decisions;
+    std::uint64_t m_pass{0};
+
+    // Serializes passes, a pass drops m_mutex while it waits for a move.
+    std::mutex m_passMutex;
+
+    mutable std::mutex m_runMutex;
+    std::condition_variable m_wakeup;
+    std::thread m_runner;
+    bool m_stopRequested{false};
+};
+} // namespace CoreAsync
+
+#endif // TA_REBALANCER_H
@@ -51,6 +51,14 @@ template <BufferOperatorType OType = BufferWriter> class TA_Serializer {
         init();
     }
 
+    // Serializes into or out of memory, see TA_MemoryBufferWriter and TA_MemoryBufferReader.
+    template <typename Memory>
+        requires MemoryOperatorType<OType> && std::constructible_from<typename OType::OperatorType, Memory &&>
+    explicit TA_Serializer(Memory &&memory, std::size_t version = 1)
+        : m_pDataOperator(new OType::OperatorType(std::forward<Memory>(memory))), m_version(version) {
+        init();
+    }
+
     ~TA_Serializer() { destroy(); }
 
     TA_Serializer(const TA_Serializer &serialzation) = delete;
@@ -65,20 +73,30 @@ template <BufferOperatorType OType = BufferWriter> class TA_Serializer {
 
     void close() { m_pDataOperator->close(); }
 
+    // Set once a read runs past the end of the data. Whatever was read from then on is unspecified.
+    bool failed() const { return m_failed; }
+
+    // Bytes a memory reader has not consumed yet.
+    std::size_t remaining() const
+        requires MemoryOperatorType<OType> && ReaderOperatorType<OType>
+    {
+        return static_cast<const typename OType::OperatorType *>(m_pDataOperator)->remaining();
+    }
+
     template <CustomType T> TA_Serializer &operator<<(const T &t) {
-        static_assert(std::is_same_v<BufferWriter, OType>, "The operation type isn't Serialization ");
+        static_assert(WriterOperatorType<OType>, "The operation type isn't Serialization ");
         extractProperty(t, std::make_index_sequence<Reflex::TA_TypeInfo<T>::TA_PropertyInfos::size>{});
         return *this;
     }
 
     template <CustomType T> TA_Serializer &operator>>(T &t) {
-        static_assert(std::is_same_v<BufferReader, OType>, "The operation type isn't Deserialization");
+        static_assert(ReaderOperatorType<OType>, "The operation type isn't Deserialization");
         extractProperty(t, std::make_index_sequence<Reflex::TA_TypeInfo<T>::TA_PropertyInfos::size>{});
         return *this;
     }
 
     template <SerializableType T> TA_Serializer &operator<<(T t) {
-        static_assert(std::is_same_v<BufferWriter, OType>, "The operation type isn't Serialization ");
+        static_assert(WriterOperatorType<OType>, "The operation type isn't Serialization ");
         if (TA_EndianConversion::isSystemLittleEndian())
             TA_EndianConversion::swapEndian(&t);
         m_pDataOperator->write(t);
@@ -86,22 +104,25 @@ template <BufferOperatorType OType = BufferWriter> class TA_Serializer {
     }
 
     template <SerializableType T> TA_Serializer &operator>>(T &t) {
-        static_assert(std::is_same_v<BufferReader, OType>, "The operation type isn't Deserialization");
-        m_pDataOperator->read(t);
+        static_assert(ReaderOperatorType<OType>, "The operation type isn't Deserialization");
+        if (!m_pDataOperator->read(t)) {
+            m_failed = true;
+            return *this;
+        }
         if (TA_EndianConversion::isSystemLittleEndian())
             TA_EndianConversion::swapEndian(&t);
         return *this;
     }
 
     template <StdContainerType T> TA_Serializer &operator<<(const T &t) {
-        static_assert(std::is_same_v<BufferWriter, OType>, "The operation type isn't Serialization ");
+        static_assert(WriterOperatorType<OType>, "The operation type isn't Serialization ");
         *this << std::ranges::distance(t);
         std::ranges::for_each(std::as_const(t), [this](const T::value_type &val) { *this << val; });
         return *this;
     }
 
     template <StdAdaptorType T> TA_Serializer &operator<<(const T &t) {
-        static_assert(std::is_same_v<BufferWriter, OType>, "The operation type isn't Serialization ");
+        static_assert(WriterOperatorType<OType>, "The operation type isn't Serialization ");
         *this << std::ranges::size(t);
         T copyAdaptor = t;
         if constexpr (std::is_same_v<std::stack<typename T::value_type, typename T::container_type>, T>) {
@@ -126,7 +147,7 @@ template <BufferOperatorType OType = BufferWriter> class TA_Serializer {
     }
 
     template <typename T, std::size_t N> TA_Serializer &operator>>(std::array<T, N> &array) {
-        static_assert(std::is_same_v<BufferReader, OType>, "The operation type isn't Deserialization");
+        static_assert(ReaderOperatorType<OType>, "The operation type isn't Deserialization");
         std::size_t size;
         *this >> size;
         for (auto &v : array) {
@@ -136,24 +157,31 @@ template <BufferOperatorType OType = BufferWriter> class TA_Serializer {
     }
 
     template <StdContainerType T> TA_Serializer &operator>>(T &t) {
-        static_assert(std::is_same_v<BufferReader, OType>, "The operation type isn't Deserialization");
+        static_assert(ReaderOperatorType<OType>, "The operation type isn't Deserialization");
         std::size_t size{};
         *this >> size;
         if constexpr (std::is_same_v<std::vector<typename T::value_type>, T> ||
                       std::is_same_v<std::deque<typename T::value_type>, T>) {
+            if constexpr (MemoryOperatorType<OType> && SerializableType<typename T::value_type>) {
+                // A corrupt size must not allocate more elements than the data can hold.
+                if (size > remaining() / sizeof(typename T::value_type)) {
+                    m_failed = true;
+                    return *this;
+                }
+            }
             t.resize(size);
-            for (auto i = 0; i < size; ++i) {
+            for (std::size_t i = 0; i < size && !m_failed; ++i) {
                 *this >> t[i];
             }
         } else if constexpr (std::is_same_v<std::list<typename T::value_type>, T>) {
-            for (auto i = 0; i < size; ++i) {
+            for (std::size_t i = 0; i < size && !m_failed; ++i) {
                 typename T::value_type val;
                 *this >> val;
                 t.emplace_back(std::move(val));
             }
         } else if constexpr (std::is_same_v<std::forward_list<typename T::value_type>, T>) {
             typename std::forward_list<typename T::value_type>::iterator beginIter = t.before_begin();
-            for (auto i = 0; i < size; ++i) {
+            for (std::size_t i = 0; i < size && !m_failed; ++i) {
                 typename T::value_type val;
                 *this >> val;
                 beginIter = t.emplace_after(beginIter, std::move(val));
@@ -163,7 +191,7 @@ template <BufferOperatorType OType = BufferWriter> class TA_Serializer {
                              std::is_same_v<std::multimap<typename T::key_type, typename T::mapped_type>, T> ||
                              std::is_same_v<std::unordered_multimap<typename T::key_type, typename T::mapped_type>,
                                             T>) {
-            for (auto i = 0; i < size; ++i) {
+            for (std::size_t i = 0; i < size && !m_failed; ++i) {
                 typename T::key_type key{};
                 typename T::mapped_type val{};
                 *this >> key >> val;
@@ -173,7 +201,7 @@ template <BufferOperatorType OType = BufferWriter> class TA_Serializer {
                              std::is_same_v<std::unordered_set<typename T::key_type>, T> ||
                              std::is_same_v<std::multiset<typename T::key_type>, T> ||
                              std::is_same_v<std::unordered_multiset<typename T::key_type>, T>) {
-            for (auto i = 0; i < size; ++i) {
+            for (std::size_t i = 0; i < size && !m_failed; ++i) {
                 typename T::key_type val;
                 *this >> val;
                 t.emplace_hint(t.end(), std::move(val));
@@ -183,18 +211,18 @@ template <BufferOperatorType OType = BufferWriter> class TA_Serializer {
     }
 
     template <StdAdaptorType T> TA_Serializer &operator>>(T &t) {
-        static_assert(std::is_same_v<BufferReader, OType>, "The operation type isn't Deserialization");
+        static_assert(ReaderOperatorType<OType>, "The operation type isn't Deserialization");
         std::size_t size{};
         *this >> size;
         if constexpr (std::is_same_v<std::queue<typename T::value_type, typename T::container_type>, T>) {
-            for (auto i = 0; i < size; ++i) {
+            for (std::size_t i = 0; i < size && !m_failed; ++i) {
                 typename T::value_type val;
                 *this >> val;
                 t.emplace(std::move(val));
             }
         } else if constexpr (std::is_same_v<std::stack<typename T::value_type, typename T::container_type>, T>) {
             std::deque<typename T::value_type> temp;
-            for (auto i = 0; i < size; ++i) {
+            for (std::size_t i = 0; i < size && !m_failed; ++i) {
                 typename T::value_type val;
                 *this >> val;
                 temp.emplace_front(std::move(val));
@@ -203,7 +231,7 @@ template <BufferOperatorType OType = BufferWriter> class TA_Serializer {
         } else if constexpr (std::is_same_v<std::priority_queue<typename T::value_type, typename T::container_type,
                                                                 typename T::value_compare>,
                                             T>) {
-            for (auto i = 0; i < size; ++i) {
+            for (std::size_t i = 0; i < size && !m_failed; ++i) {
                 typename T::value_type val;
                 *this >> val;
                 t.emplace(std::move(val));
@@ -213,22 +241,22 @@ template <BufferOperatorType OType = BufferWriter> class TA_Serializer {
     }
 
     template <typename K, typename V> TA_Serializer &operator<<(const std::pair<K, V> &pair) {
-        static_assert(std::is_same_v<BufferWriter, OType>, "The operation type isn't Serialization ");
+        static_assert(WriterOperatorType<OType>, "The operation type isn't Serialization ");
         return *this << pair.first << pair.second;
     }
 
     template <typename K, typename V> TA_Serializer &operator>>(std::pair<K, V> &pair) {
-        static_assert(std::is_same_v<BufferReader, OType>, "The operation type isn't Deserialization ");
+        static_assert(ReaderOperatorType<OType>, "The operation type isn't Deserialization ");
         return *this >> pair.first >> pair.second;
     }
 
     template <RawPtr T> TA_Serializer &operator<<(const T &t) {
-        static_assert(std::is_same_v<BufferWriter, OType>, "The operation type isn't Serialization ");
+        static_assert(WriterOperatorType<OType>, "The operation type isn't Serialization ");
         return *this << *t;
     }
 
     template <RawPtr T> TA_Serializer &operator<<(T &&t) {
-        static_assert(std::is_same_v<BufferWriter, OType>, "The operation type isn't Serialization ");
+        static_assert(WriterOperatorType<OType>, "The operation type isn't Serialization ");
         if (t) {
             return *this << *t;
         }
@@ -237,14 +265,14 @@ template <BufferOperatorType OType = BufferWriter> class TA_Serializer {
     }
 
     template <RawPtr T> TA_Serializer &operator>>(T &t) {
-        static_assert(std::is_same_v<BufferReader, OType>, "The operation type isn't Deserialization");
+        static_assert(ReaderOperatorType<OType>, "The operation type isn't Deserialization");
         if (!t)
             return *this;
         return *this >> *t;
     }
 
     template <typename T, int N> TA_Serializer &operator<<(const T (&a)[N]) {
-        static_assert(std::is_same_v<BufferWriter, OType>, "The operation type isn't Serialization ");
+        static_assert(WriterOperatorType<OType>, "The operation type isn't Serialization ");
         for (int i = 0; i < N; ++i) {
             *this << a[i];
         }
@@ -252,7 +280,7 @@ template <BufferOperatorType OType = BufferWriter> class TA_Serializer {
     }
 
     template <typename T, int N> TA_Serializer &operator>>(T (&a)[N]) {
-        static_assert(std::is_same_v<BufferReader, OType>, "The operation type isn't Deserialization");
+        static_assert(ReaderOperatorType<OType>, "The operation type isn't Deserialization");
         for (int i = 0; i < N; ++i) {
             *this >> a[i];
         }
@@ -260,13 +288,13 @@ template <BufferOperatorType OType = BufferWriter> class TA_Serializer {
     }
 
     template <EnumType T> TA_Serializer &operator<<(T t) {
-        static_assert(std::is_same_v<BufferWriter, OType>, "The operation type isn't Serialization ");
+        static_assert(WriterOperatorType<OType>, "The operation type isn't Serialization ");
         *this << static_cast<uint8_t>(t);
         return *this;
     }
 
     template <EnumType T> TA_Serializer &operator>>(T &t) {
-        static_assert(std::is_same_v<BufferReader, OType>, "The operation type isn't Deserialization");
+        static_assert(ReaderOperatorType<OType>, "The operation type isn't Deserialization");
         uint8_t val{};
         *this >> val;
         t = static_cast<T>(val);
@@ -274,12 +302,12 @@ template <BufferOperatorType OType = BufferWriter> class TA_Serializer {
     }
 
     TA_Serializer &operator<<(std::nullptr_t) {
-        static_assert(std::is_same_v<BufferWriter, OType>, "The operation type isn't Serialization ");
+        static_assert(WriterOperatorType<OType>, "The operation type isn't Serialization ");
         return *this;
     }
 
     TA_Serializer &operator>>(std::nullptr_t) {
-        static_assert(std::is_same_v<BufferWriter, OType>, "The operation type isn't Deserialization");
+        static_assert(WriterOperatorType<OType>, "The operation type isn't Deserialization");
         return *this;
     }
 
@@ -295,7 +323,7 @@ template <BufferOperatorType OType = BufferWriter> class TA_Serializer {
         static_assert(CoreAsync::Reflex::HasValidString<
                           std::tuple_element_t<0, typename CoreAsync::MetaTypeAt<Properties, IDX0>::type>>::value,
                       "Invalid name retrieved during serialization.");
-        if constexpr (std::is_same_v<BufferWriter, OType>) {
+        if constexpr (WriterOperatorType<OType>) {
             if (m_version >= std::tuple_element_t<1, typename CoreAsync::MetaTypeAt<Properties, IDX0>::type>::m_value) {
                 *this << Reflex::TA_TypeInfo<Rt>::invoke(
                     std::tuple_element_t<0, typename CoreAsync::MetaTypeAt<Properties, IDX0>::type>{}, t);
@@ -328,8 +356,9 @@ template <BufferOperatorType OType = BufferWriter> class TA_Serializer {
             CoreAsync::TA_CommonTools::debugInfo(META_STRING("Cannot open the file.\n"));
             return false;
         }
-        if constexpr (std::is_same_v<BufferReader, OType>) {
-            return m_pDataOperator->read(m_version);
+        if constexpr (ReaderOperatorType<OType>) {
+            m_failed = !m_pDataOperator->read(m_version);
+            return !m_failed;
         } else
             return m_pDataOperator->write(m_version);
     }
@@ -337,6 +366,7 @@ template <BufferOperatorType OType = BufferWriter> class TA_Serializer {
   private:
     OType *m_pDataOperator;
     std::size_t m_version;
+    bool m_failed{false};
 };
 } // namespace CoreAsync
 
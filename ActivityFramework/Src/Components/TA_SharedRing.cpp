@@ -0,0 +1,236 @@
+/*
+ * Copyright [2025] [Shuang Zhu / Sol]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Components/TA_SharedRing.h"
+
+#if defined(__linux__) && !defined(__ANDROID__)
+
+#include <algorithm>
+#include <bit>
+#include <climits>
+#include <new>
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace CoreAsync {
+namespace {
+constexpr std::uint64_t ringMagic{0x5441524e47303031}; // "TARNG001"
+
+// The segment is shared between processes, so the futex can't be a private one.
+void futexWait(std::atomic_uint32_t &word, std::uint32_t expected, std::chrono::milliseconds timeout) {
+    const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(timeout);
+    timespec duration{static_cast<time_t>(seconds.count()),
+                      static_cast<long>(std::chrono::nanoseconds(timeout - seconds).count())};
+    syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&word), FUTEX_WAIT, expected, &duration, nullptr, 0);
+}
+
+void futexWake(std::atomic_uint32_t &word) {
+    syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+}
+
+// Wakes the other side if it announced that it sleeps on the word. The fence pairs with the one in sleepOn().
+bool wakeIfWaiting(std::atomic_uint32_t &sequence, std::atomic_uint32_t &waiting) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!waiting.load(std::memory_order_relaxed)) {
+        return false;
+    }
+    sequence.fetch_add(1, std::memory_order_release);
+    futexWake(sequence);
+    return true;
+}
+
+template <typename Ready>
+bool sleepOn(std::atomic_uint32_t &sequence, std::atomic_uint32_t &waiting, std::chrono::milliseconds timeout,
+             Ready &&ready) {
+    const std::uint32_t current{sequence.load(std::memory_order_acquire)};
+    waiting.store(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!ready()) {
+        futexWait(sequence, current, timeout);
+    }
+    waiting.store(0, std::memory_order_relaxed);
+    return ready();
+}
+} // namespace
+
+std::unique_ptr<TA_SharedRing> TA_SharedRing::create(const std::string &name, std::size_t capacity) {
+    int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+        return nullptr;
+    }
+    auto pRing = map(fd, capacity, true, name);
+    if (!pRing) {
+        shm_unlink(name.c_str());
+    }
+    return pRing;
+}
+
+std::unique_ptr<TA_SharedRing> TA_SharedRing::createAnonymous(std::size_t capacity) {
+    int fd = memfd_create("TA_SharedRing", 0);
+    if (fd < 0) {
+        return nullptr;
+    }
+    return map(fd, capacity, true, {});
+}
+
+std::unique_ptr<TA_SharedRing> TA_SharedRing::open(const std::string &name) {
+    int fd = shm_open(name.c_str(), O_RDWR, 0600);
+    if (fd < 0) {
+        return nullptr;
+    }
+    return map(fd, 0, false, {});
+}
+
+std::unique_ptr<TA_SharedRing> TA_SharedRing::fromFd(int fd) { return map(fd, 0, false, {}); }
+
+std::unique_ptr<TA_SharedRing> TA_SharedRing::map(int fd, std::size_t capacity, bool initialize, std::string name) {
+    std::size_t segmentSize{0};
+    if (initialize) {
+        capacity = std::bit_ceil(std::max<std::size_t>(capacity, 64));
+        segmentSize = sizeof(Header) + capacity;
+        if (ftruncate(fd, static_cast<off_t>(segmentSize)) != 0) {
+            ::close(fd);
+            return nullptr;
+        }
+    } else {
+        struct stat info{};
+        if (fstat(fd, &info) != 0 || static_cast<std::size_t>(info.st_size) <= sizeof(Header)) {
+            ::close(fd);
+            return nullptr;
+        }
+        segmentSize = static_cast<std::size_t>(info.st_size);
+    }
+    void *pSegment = mmap(nullptr, segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (pSegment == MAP_FAILED) {
+        ::close(fd);
+        return nullptr;
+    }
+    if (initialize) {
+        auto *pHeader = new (pSegment) Header{};
+        pHeader->capacity = capacity;
+        std::atomic_ref<std::uint64_t>(pHeader->magic).store(ringMagic, std::memory_order_release);
+    } else {
+        auto *pHeader = static_cast<Header *>(pSegment);
+        if (std::atomic_ref<std::uint64_t>(pHeader->magic).load(std::memory_order_acquire) != ringMagic ||
+            !std::has_single_bit(pHeader->capacity) || sizeof(Header) + pHeader->capacity != segmentSize) {
+            munmap(pSegment, segmentSize);
+            ::close(fd);
+            return nullptr;
+        }
+    }
+    return std::unique_ptr<TA_SharedRing>(new TA_SharedRing(fd, pSegment, segmentSize, std::move(name)));
+}
+
+TA_SharedRing::TA_SharedRing(int fd, void *pSegment, std::size_t segmentSize, std::string name)
+    : m_fd(fd), m_pSegment(pSegment), m_segmentSize(segmentSize), m_name(std::move(name)),
+      m_pHeader(static_cast<Header *>(pSegment)), m_pData(static_cast<char *>(pSegment) + sizeof(Header)),
+      m_capacity(m_pHeader->capacity) {
+    // A ring mapped again after a restart continues from the shared positions.
+    m_writePos = m_pHeader->head.load(std::memory_order_acquire);
+    m_cachedTail = m_readPos = m_pHeader->tail.load(std::memory_order_acquire);
+}
+
+TA_SharedRing::~TA_SharedRing() {
+    munmap(m_pSegment, m_segmentSize);
+    ::close(m_fd);
+    if (!m_name.empty()) {
+        shm_unlink(m_name.c_str());
+    }
+}
+
+bool TA_SharedRing::write(std::span<const char> record) {
+    if (record.size() > maxRecordSize()) {
+        return false;
+    }
+    const std::size_t space{recordSpace(record.size())};
+    const std::size_t offset{m_writePos & (m_capacity - 1)};
+    // A record never wraps, the rest of the ring is skipped instead.
+    const std::size_t padding{offset + space > m_capacity ? m_capacity - offset : 0};
+    if (m_writePos + padding + space - m_cachedTail > m_capacity) {
+        m_cachedTail = m_pHeader->tail.load(std::memory_order_acquire);
+        if (m_writePos + padding + space - m_cachedTail > m_capacity) {
+            return false;
+        }
+    }
+    if (padding) {
+        memcpy(m_pData + offset, &paddingMark, sizeof(paddingMark));
+        m_writePos += padding;
+    }
+    const std::uint32_t size{static_cast<std::uint32_t>(record.size())};
+    char *pRecord = m_pData + (m_writePos & (m_capacity - 1));
+    memcpy(pRecord, &size, sizeof(size));
+    memcpy(pRecord + sizeof(size), record.data(), record.size());
+    m_writePos += space;
+    return true;
+}
+
+void TA_SharedRing::publish() {
+    if (m_pHeader->head.load(std::memory_order_relaxed) == m_writePos) {
+        return;
+    }
+    m_pHeader->head.store(m_writePos, std::memory_order_release);
+    if (wakeIfWaiting(m_pHeader->dataSequence, m_pHeader->consumerWaiting)) {
+        ++m_wakeups;
+    }
+}
+
+bool TA_SharedRing::waitForSpace(std::chrono::milliseconds timeout) {
+    const std::uint64_t tail{m_cachedTail};
+    return sleepOn(m_pHeader->spaceSequence, m_pHeader->producerWaiting, timeout, [this, tail]() {
+        return m_pHeader->tail.load(std::memory_order_acquire) != tail ||
+               m_pHeader->closed.load(std::memory_order_acquire);
+    }) && !isClosed();
+}
+
+void TA_SharedRing::release() {
+    m_pHeader->tail.store(m_readPos, std::memory_order_release);
+    wakeIfWaiting(m_pHeader->spaceSequence, m_pHeader->producerWaiting);
+}
+
+void TA_SharedRing::discardCorrupt(std::uint64_t head) {
+    m_readPos = head;
+    release();
+    close();
+}
+
+bool TA_SharedRing::wait(std::chrono::milliseconds timeout) {
+    if (!isEmpty()) {
+        return true;
+    }
+    return sleepOn(m_pHeader->dataSequence, m_pHeader->consumerWaiting, timeout,
+                   [this]() { return !isEmpty() || isClosed(); }) &&
+           !isEmpty();
+}
+
+bool TA_SharedRing::isEmpty() const { return m_pHeader->head.load(std::memory_order_acquire) == m_readPos; }
+
+void TA_SharedRing::close() {
+    m_pHeader->closed.store(1, std::memory_order_release);
+    m_pHeader->dataSequence.fetch_add(1, std::memory_order_release);
+    m_pHeader->spaceSequence.fetch_add(1, std::memory_order_release);
+    futexWake(m_pHeader->dataSequence);
+    futexWake(m_pHeader->spaceSequence);
+}
+
+bool TA_SharedRing::isClosed() const { return m_pHeader->closed.load(std::memory_order_acquire) != 0; }
+} // namespace CoreAsync
+
+#endif
@@ -0,0 +1,165 @@
+/*
+ * Copyright [2025] [Shuang Zhu / Sol]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TA_SHAREDRING_H
+#define TA_SHAREDRING_H
+
+#include "TA_ActivityFramework_global.h"
+
+#if defined(__linux__) && !defined(__ANDROID__)
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <string>
+
+namespace CoreAsync {
+/*
+ * Lock-free single-producer single-consumer ring of variable-sized records in a shared memory segment, for passing
+ * messages between processes on one host. Records written by the producer stay invisible until publish(), so a batch
+ * costs one release store and at most one wakeup. A consumer with nothing to read sleeps on a futex in the segment,
+ * and the producer only issues the wake syscall when the consumer announced that it sleeps. A producer can wait for
+ * room the same way.
+ *
+ * The segment is either a named POSIX shared memory object or an anonymous memfd whose descriptor is inherited or
+ * passed to the other process. Linux only.
+ */
+class ACTIVITY_FRAMEWORK_EXPORT TA_SharedRing {
+  public:
+    // The capacity is rounded up to a power of two. A named segment is unlinked when its creator is destroyed.
+    static std::unique_ptr<TA_SharedRing> create(const std::string &name, std::size_t capacity);
+    static std::unique_ptr<TA_SharedRing> createAnonymous(std::size_t capacity);
+    static std::unique_ptr<TA_SharedRing> open(const std::string &name);
+    // Maps a segment created by createAnonymous() in another process, the ring takes over the descriptor.
+    static std::unique_ptr<TA_SharedRing> fromFd(int fd);
+
+    ~TA_SharedRing();
+
+    TA_SharedRing(const TA_SharedRing &ring) = delete;
+    TA_SharedRing &operator=(const TA_SharedRing &ring) = delete;
+
+    int fd() const { return m_fd; }
+    std::size_t capacity() const { return m_capacity; }
+    // Largest record write() accepts.
+    std::size_t maxRecordSize() const { return m_capacity / 2 - sizeof(std::uint32_t); }
+
+    // Producer side. Copies a record behind the ones written before, returns false if there is no room.
+    bool write(std::span<const char> record);
+    // Makes the records written so far visible and wakes the consumer if it sleeps.
+    void publish();
+    // Waits until the consumer has released room or the ring is closed. Returns false on timeout or when closed.
+    bool waitForSpace(std::chrono::milliseconds timeout);
+
+    // Consumer side. Hands up to maxRecords published records to fn, which must not keep the data. Their room is
+    // released at once afterwards. The framing comes from the other process, a record that doesn't fit into the ring
+    // or the published range means the record boundaries are lost: the rest is discarded and the ring is closed.
+    template <typename Fn> std::size_t read(Fn &&fn, std::size_t maxRecords = SIZE_MAX) {
+        std::uint64_t pos{m_readPos};
+        const std::uint64_t head{m_pHeader->head.load(std::memory_order_acquire)};
+        std::size_t count{0};
+        if (head - pos > m_capacity) {
+            discardCorrupt(head);
+            return 0;
+        }
+        while (pos != head && count < maxRecords) {
+            const std::size_t offset{pos & (m_capacity - 1)};
+            if (m_capacity - offset < sizeof(std::uint32_t)) {
+                discardCorrupt(head);
+                return count;
+            }
+            std::uint32_t size;
+            memcpy(&size, m_pData + offset, sizeof(size));
+            if (size == paddingMark) {
+                if (m_capacity - offset > head - pos) {
+                    discardCorrupt(head);
+                    return count;
+                }
+                pos += m_capacity - offset;
+                continue;
+            }
+            if (size > m_capacity - offset - sizeof(size) || recordSpace(size) > head - pos) {
+                discardCorrupt(head);
+                return count;
+            }
+            fn(std::span<const char>(m_pData + offset + sizeof(size), size));
+            pos += recordSpace(size);
+            ++count;
+        }
+        if (pos != m_readPos) {
+            m_readPos = pos;
+            release();
+        }
+        return count;
+    }
+    // Waits until a record is published or the ring is closed. Returns false on timeout or when closed and empty.
+    bool wait(std::chrono::milliseconds timeout);
+    bool isEmpty() const;
+
+    // Wakes both sides for good, records already published can still be read.
+    void close();
+    bool isClosed() const;
+
+    std::uint64_t wakeups() const { return m_wakeups; }
+
+  private:
+    // Start of the segment, the records follow it.
+    struct Header {
+        std::uint64_t magic{0};
+        std::uint64_t capacity{0};
+        alignas(64) std::atomic_uint64_t head{0};
+        alignas(64) std::atomic_uint64_t tail{0};
+        // Futex words. A side that goes to sleep announces it first, the other side bumps the sequence before it
+        // wakes, so a wakeup can't get lost between the check and the sleep.
+        alignas(64) std::atomic_uint32_t dataSequence{0};
+        std::atomic_uint32_t consumerWaiting{0};
+        alignas(64) std::atomic_uint32_t spaceSequence{0};
+        std::atomic_uint32_t producerWaiting{0};
+        std::atomic_uint32_t closed{0};
+    };
+
+    static constexpr std::uint32_t paddingMark{0xffffffff};
+
+    static std::unique_ptr<TA_SharedRing> map(int fd, std::size_t capacity, bool initialize, std::string name);
+    static std::size_t recordSpace(std::size_t size) { return (sizeof(std::uint32_t) + size + 7) & ~std::size_t{7}; }
+
+    TA_SharedRing(int fd, void *pSegment, std::size_t segmentSize, std::string name);
+
+    void release();
+    void discardCorrupt(std::uint64_t head);
+
+  private:
+    int m_fd{-1};
+    void *m_pSegment{nullptr};
+    std::size_t m_segmentSize{0};
+    std::string m_name;
+    Header *m_pHeader{nullptr};
+    char *m_pData{nullptr};
+    std::size_t m_capacity{0};
+
+    // Owned by the producer.
+    std::uint64_t m_writePos{0}, m_cachedTail{0};
+    std::uint64_t m_wakeups{0};
+    // Owned by the consumer.
+    std::uint64_t m_readPos{0};
+};
+} // namespace CoreAsync
+
+#endif
+
+#endif // TA_SHAREDRING_H
@@ -0,0 +1,301 @@
+/*
+ * Copyright [2025] [Shuang Zhu / Sol]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TA_SIGNALBRIDGE_H
+#define TA_SIGNALBRIDGE_H
+
+#include "TA_MetaObject.h"
+#include "TA_Serialization.h"
+#include "TA_SharedRing.h"
+
+#if defined(__linux__) && !defined(__ANDROID__)
+
+#include <string_view>
+#include <typeinfo>
+#include <unordered_map>
+
+namespace CoreAsync {
+// Identifies a signal on a bridge. Unless a name is given, both ends derive it from the reflected name of the signal.
+// The argument types are hashed in as well, so a record only reaches a signal that decodes the same layout. Their
+// mangled names are the same for every compiler following the Itanium ABI.
+template <typename Sender, typename... Args>
+std::uint64_t bridgeChannel(void (std::decay_t<Sender>::*signal)(Args...), std::string_view name = {}) {
+    if (name.empty()) {
+        name = Reflex::TA_TypeInfo<std::decay_t<Sender>>::findName(signal);
+    }
+    std::uint64_t hash{0xcbf29ce484222325};
+    auto mix = [&hash](std::string_view text) {
+        for (char ch : text) {
+            hash = (hash ^ static_cast<unsigned char>(ch)) * 0x100000001b3;
+        }
+        // Same as hashing a terminating null, so where one name ends is part of the hash.
+        hash *= 0x100000001b3;
+    };
+    mix(name);
+    (mix(typeid(std::remove_cvref_t<Args>).name()), ...);
+    return hash;
+}
+
+/*
+ * Sending end of a signal bridge between two processes. Forwarded signals are connected to the proxy, which encodes
+ * the channel and the arguments of every emission with a TA_Serializer and writes them as one record into a
+ * TA_SharedRing. Records are published in batches: a batch is published when it reaches maxBatch records, or by a
+ * flush activity that the first record of a batch schedules, so a quiet signal still goes out right away. The ring
+ * has a single producer, emissions from several threads are serialized by the proxy.
+ *
+ * With TA_MailboxOverflow::Block a full ring blocks the emitting thread, often a pool worker, and every other emission
+ * of the proxy behind it. The wait ends in a drop after maxBlock, and until a record fits again further emissions
+ * that find the ring full are dropped at once, so a peer that stopped reading costs one wait and not one per
+ * emission. Other policies drop right away, records already in the other process can't be discarded.
+ */
+class TA_SignalBridgeProxy : public TA_MetaObject {
+    struct Producer : std::enable_shared_from_this<Producer> {
+        Producer(std::shared_ptr<TA_SharedRing> pRing, std::size_t maxBatch, TA_MailboxOverflow overflow,
+                 std::chrono::milliseconds maxBlock)
+            : pRing(std::move(pRing)), maxBatch(std::max<std::size_t>(maxBatch, 1)), overflow(overflow),
+              maxBlock(maxBlock) {}
+
+        template <typename... Args> void send(std::uint64_t channel, const Args &...args) {
+            std::unique_lock<std::mutex> locker(mutex);
+            scratch.clear();
+            {
+                TA_Serializer<MemoryBufferWriter> writer(scratch);
+                writer << channel;
+                ((writer << args), ...);
+            }
+            const auto deadline = std::chrono::steady_clock::now() + maxBlock;
+            while (!pRing->write(scratch)) {
+                // Whatever is pending has to be visible before the consumer can make room.
+                publish();
+                const auto now = std::chrono::steady_clock::now();
+                if (overflow != TA_MailboxOverflow::Block || scratch.size() > pRing->maxRecordSize() ||
+                    pRing->isClosed() || stalled || now >= deadline) {
+                    stalled = overflow == TA_MailboxOverflow::Block && !pRing->isClosed();
+                    droppedCount.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+                pRing->waitForSpace(std::min<std::chrono::milliseconds>(
+                    std::chrono::ceil<std::chrono::milliseconds>(deadline - now), std::chrono::milliseconds(100)));
+            }
+            stalled = false;
+            sentCount.fetch_add(1, std::memory_order_relaxed);
+            if (++pending >= maxBatch) {
+                publish();
+            } else if (pending == 1 && !flushScheduled.exchange(true, std::memory_order_acq_rel)) {
+                locker.unlock();
+                scheduleFlush();
+            }
+        }
+
+        void flush() {
+            std::lock_guard<std::mutex> locker(mutex);
+            publish();
+        }
+
+        void publish() {
+            if (pending) {
+                pRing->publish();
+                pending = 0;
+                batchCount.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        void scheduleFlush() {
+            auto activity = TA_ActivityCreator::create([wpProducer = weak_from_this()]() -> void {
+                if (auto pProducer = wpProducer.lock()) {
+                    pProducer->flushScheduled.store(false, std::memory_order_release);
+                    pProducer->flush();
+                }
+            });
+            auto fetcher = TA_ThreadHolder::get().postActivity(activity, true);
+        }
+
+        std::shared_ptr<TA_SharedRing> pRing;
+        const std::size_t maxBatch;
+        const TA_MailboxOverflow overflow;
+        const std::chrono::milliseconds maxBlock;
+        std::mutex mutex;
+        std::vector<char> scratch;
+        std::size_t pending{0};
+        // A blocking send ran into its deadline and nothing was written since.
+        bool stalled{false};
+        std::atomic_bool flushScheduled{false};
+        std::atomic_size_t sentCount{0}, droppedCount{0}, batchCount{0};
+    };
+
+  public:
+    explicit TA_SignalBridgeProxy(std::shared_ptr<TA_SharedRing> pRing, std::size_t maxBatch = 64,
+                                  TA_MailboxOverflow overflow = TA_MailboxOverflow::Block,
+                                  std::chrono::milliseconds maxBlock = std::chrono::seconds(1))
+        : m_pProducer(std::make_shared<Producer>(std::move(pRing), maxBatch, overflow, maxBlock)) {}
+
+    ~TA_SignalBridgeProxy() override {
+        for (auto &connection : m_connections) {
+            TA_MetaObject::unregisterConnection(connection);
+        }
+        m_pProducer->flush();
+    }
+
+    TA_SignalBridgeProxy(const TA_SignalBridgeProxy &proxy) = delete;
+    TA_SignalBridgeProxy &operator=(const TA_SignalBridgeProxy &proxy) = delete;
+
+    // Every argument of the signal has to be serializable by TA_Serializer.
+    template <EnableConnectObjectType Sender, typename... Args>
+    bool forward(Sender *pSender, void (std::decay_t<Sender>::*signal)(Args...), std::string_view name = {}) {
+        const std::uint64_t channel{bridgeChannel<Sender>(signal, name)};
+        auto connection = TA_MetaObject::registerConnection(
+            pSender, std::move(signal),
+            [pProducer = m_pProducer, channel](Args... args) { pProducer->send(channel, args...); },
+            TA_ConnectionType::Auto);
+        if (!connection.valid()) {
+            return false;
+        }
+        m_connections.emplace_back(std::move(connection));
+        return true;
+    }
+
+    // Publishes the current batch without waiting for it to fill up.
+    void flush() { m_pProducer->flush(); }
+
+    std::size_t sentCount() const { return m_pProducer->sentCount.load(std::memory_order_relaxed); }
+    std::size_t droppedCount() const { return m_pProducer->droppedCount.load(std::memory_order_relaxed); }
+    std::size_t batchCount() const { return m_pProducer->batchCount.load(std::memory_order_relaxed); }
+
+  private:
+    std::shared_ptr<Producer> m_pProducer;
+    std::vector<TA_ConnectionObjectHolder> m_connections;
+};
+
+/*
+ * Receiving end of a signal bridge. It reads the records of the ring and emits the signal of the same channel on a
+ * local object, whose connections then deliver it as usual. poll() does this on the calling thread, start() on a
+ * thread of its own that sleeps on the ring while it is empty. Exposed objects have to outlive the stub.
+ */
+class TA_SignalBridgeStub {
+  public:
+    explicit TA_SignalBridgeStub(std::shared_ptr<TA_SharedRing> pRing) : m_pRing(std::move(pRing)) {}
+
+    ~TA_SignalBridgeStub() { stop(); }
+
+    TA_SignalBridgeStub(const TA_SignalBridgeStub &stub) = delete;
+    TA_SignalBridgeStub &operator=(const TA_SignalBridgeStub &stub) = delete;
+
+    template <EnableConnectObjectType Sender, typename... Args>
+    bool expose(Sender *pSender, void (std::decay_t<Sender>::*signal)(Args...), std::string_view name = {}) {
+        using Signal = void (std::decay_t<Sender>::*)(Args...);
+        const std::uint64_t channel{bridgeChannel<Sender>(signal, name)};
+        std::lock_guard<std::mutex> locker(m_mutex);
+        return m_decoders
+            .emplace(channel,
+                     [pSender, signal](TA_Serializer<MemoryBufferReader> &reader) -> bool {
+                         std::tuple<std::remove_cvref_t<Args>...> args{};
+                         try {
+                             std::apply([&reader](auto &...arg) { ((reader >> arg), ...); }, args);
+                         } catch (const std::exception &) {
+                             // A corrupt size can still make a container fail to allocate.
+                             return false;
+                         }
+                         // Only a record that holds exactly the arguments is emitted.
+                         if (reader.failed() || reader.remaining() != 0) {
+                             return false;
+                         }
+                         std::apply(
+                             [pSender, signal](auto &...arg) {
+                                 TA_MetaObject::emitSignal(pSender, Signal{signal}, std::move(arg)...);
+                             },
+                             args);
+                         return true;
+                     })
+            .second;
+    }
+
+    // Emits the signals of up to maxMessages received records.
+    std::size_t poll(std::size_t maxMessages = SIZE_MAX) {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        return m_pRing->read(
+            [this](std::span<const char> record) {
+                TA_Serializer<MemoryBufferReader> reader(record);
+                std::uint64_t channel{0};
+                reader >> channel;
+                if (reader.failed()) {
+                    m_badCount.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+                auto iter = m_decoders.find(channel);
+                if (iter == m_decoders.end()) {
+                    m_unknownCount.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+                if (!iter->second(reader)) {
+                    m_badCount.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+                m_receivedCount.fetch_add(1, std::memory_order_relaxed);
+            },
+            maxMessages);
+    }
+
+    bool start() {
+        std::lock_guard<std::mutex> locker(m_runMutex);
+        if (m_runner.joinable()) {
+            return false;
+        }
+        m_stopRequested.store(false, std::memory_order_release);
+        m_runner = std::thread([this]() {
+            while (!m_stopRequested.load(std::memory_order_acquire)) {
+                if (m_pRing->wait(std::chrono::milliseconds(100))) {
+                    poll();
+                } else if (m_pRing->isClosed()) {
+                    break;
+                }
+            }
+        });
+        return true;
+    }
+
+    void stop() {
+        std::thread runner;
+        {
+            std::lock_guard<std::mutex> locker(m_runMutex);
+            m_stopRequested.store(true, std::memory_order_release);
+            runner = std::move(m_runner);
+        }
+        if (runner.joinable()) {
+            runner.join();
+        }
+    }
+
+    std::size_t receivedCount() const { return m_receivedCount.load(std::memory_order_relaxed); }
+    // Records of channels nothing is exposed on.
+    std::size_t unknownCount() const { return m_unknownCount.load(std::memory_order_relaxed); }
+    // Records that don't decode to exactly the arguments of their channel, they are not emitted.
+    std::size_t badCount() const { return m_badCount.load(std::memory_order_relaxed); }
+
+  private:
+    std::shared_ptr<TA_SharedRing> m_pRing;
+    std::mutex m_mutex;
+    std::unordered_map<std::uint64_t, std::function<bool(TA_Serializer<MemoryBufferReader> &)>> m_decoders;
+    std::atomic_size_t m_receivedCount{0}, m_unknownCount{0}, m_badCount{0};
+
+    std::mutex m_runMutex;
+    std::thread m_runner;
+    std::atomic_bool m_stopRequested{false};
+};
+} // namespace CoreAsync
+
+#endif
+
+#endif // TA_SIGNALBRIDGE_H
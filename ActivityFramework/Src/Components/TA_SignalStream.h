@@ -0,0 +1,239 @@
+/*
+ * Copyright [2025] [Shuang Zhu / Sol]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TA_SIGNALSTREAM_H
+#define TA_SIGNALSTREAM_H
+
+#include "TA_MetaObject.h"
+#include "TA_BoundedQueue.h"
+#include "TA_Mailbox.h"
+
+#include <coroutine>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace CoreAsync {
+/*
+ * Multi-shot counterpart of TA_SignalAwaitable. The stream connects to the signal once and buffers every emission in a
+ * bounded ring until a coroutine takes it with co_await next() or nextBatch(), so nothing emitted between two awaits is
+ * lost. The overflow policy decides what happens to emissions that find the ring full. A stream has a single consumer;
+ * a suspended consumer is resumed on the thread that runs the connection, like TA_SignalAwaitable. As with mailboxes, a
+ * Block emission is rejected when it runs on the thread the consumer is running on, since it could never get room.
+ */
+template <EnableConnectObjectType Sender, typename... Args> class TA_SignalStream {
+    template <typename... Ts> struct Value {
+        using type = std::tuple<Ts...>;
+    };
+
+    template <typename T> struct Value<T> {
+        using type = T;
+    };
+
+  public:
+    using ValueType = typename Value<std::remove_cvref_t<Args>...>::type;
+
+  private:
+    struct State {
+        State(std::size_t capacity, TA_MailboxOverflow overflow) : buffer(capacity), overflow(overflow) {}
+
+        void push(ValueType &&value) {
+            while (!buffer.push(std::move(value))) {
+                if (closed.load(std::memory_order_acquire)) {
+                    return;
+                }
+                if (overflow == TA_MailboxOverflow::DropOldest) {
+                    ValueType oldest;
+                    if (buffer.pop(oldest)) {
+                        droppedCount.fetch_add(1, std::memory_order_relaxed);
+                    }
+                } else if (overflow == TA_MailboxOverflow::Block &&
+                           consumerThread.load(std::memory_order_acquire) != std::this_thread::get_id()) {
+                    std::this_thread::yield();
+                } else {
+                    droppedCount.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+            }
+            wake();
+        }
+
+        // Pairs with the fence in suspend(): either the consumer sees the new value, or its handle is visible here.
+        void wake() {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (!pWaiter.load(std::memory_order_relaxed)) {
+                return;
+            }
+            if (void *pHandle = pWaiter.exchange(nullptr, std::memory_order_acq_rel)) {
+                std::coroutine_handle<>::from_address(pHandle).resume();
+            }
+        }
+
+        // Records the thread the consumer runs on until it suspends.
+        void enter() { consumerThread.store(std::this_thread::get_id(), std::memory_order_release); }
+
+        bool suspend(std::coroutine_handle<> handle) {
+            consumerThread.store(std::thread::id{}, std::memory_order_release);
+            pWaiter.store(handle.address(), std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (buffer.isEmpty() && !closed.load(std::memory_order_acquire)) {
+                return true;
+            }
+            // A value or close() raced with the suspension. Unless a producer already took the handle to resume it,
+            // the consumer goes on right away.
+            return pWaiter.exchange(nullptr, std::memory_order_acq_rel) == nullptr;
+        }
+
+        // After a wake-up the value may still be on its way: a DropOldest producer can evict the last value before it
+        // pushes its own.
+        bool waitValue(ValueType &value) {
+            while (!buffer.pop(value)) {
+                if (closed.load(std::memory_order_acquire) && buffer.isEmpty()) {
+                    return false;
+                }
+                std::this_thread::yield();
+            }
+            return true;
+        }
+
+        TA_BoundedQueue<ValueType> buffer;
+        const TA_MailboxOverflow overflow;
+        std::atomic<void *> pWaiter{nullptr};
+        std::atomic<std::thread::id> consumerThread{};
+        std::atomic_bool closed{false};
+        std::atomic_size_t droppedCount{0};
+    };
+
+  public:
+    class NextAwaiter {
+      public:
+        explicit NextAwaiter(std::shared_ptr<State> pState) : m_pState(std::move(pState)) {}
+
+        bool await_ready() {
+            m_pState->enter();
+            ValueType value;
+            if (m_pState->buffer.pop(value)) {
+                m_value = std::move(value);
+                return true;
+            }
+            return m_pState->closed.load(std::memory_order_acquire) && m_pState->buffer.isEmpty();
+        }
+
+        bool await_suspend(std::coroutine_handle<> handle) { return m_pState->suspend(handle); }
+
+        // Empty once the stream is closed and drained.
+        std::optional<ValueType> await_resume() {
+            m_pState->enter();
+            if (!m_value) {
+                ValueType value;
+                if (m_pState->waitValue(value)) {
+                    m_value = std::move(value);
+                }
+            }
+            return std::move(m_value);
+        }
+
+      private:
+        std::shared_ptr<State> m_pState;
+        std::optional<ValueType> m_value{};
+    };
+
+    class BatchAwaiter {
+      public:
+        BatchAwaiter(std::shared_ptr<State> pState, std::size_t maxSize)
+            : m_pState(std::move(pState)), m_maxSize(std::max<std::size_t>(maxSize, 1)) {}
+
+        bool await_ready() {
+            m_pState->enter();
+            takeAvailable();
+            return !m_values.empty() || (m_pState->closed.load(std::memory_order_acquire) && m_pState->buffer.isEmpty());
+        }
+
+        bool await_suspend(std::coroutine_handle<> handle) { return m_pState->suspend(handle); }
+
+        // Holds at least one value, empty once the stream is closed and drained.
+        std::vector<ValueType> await_resume() {
+            m_pState->enter();
+            if (m_values.empty()) {
+                ValueType value;
+                if (m_pState->waitValue(value)) {
+                    m_values.emplace_back(std::move(value));
+                }
+                takeAvailable();
+            }
+            return std::move(m_values);
+        }
+
+      private:
+        void takeAvailable() {
+            ValueType value;
+            while (m_values.size() < m_maxSize && m_pState->buffer.pop(value)) {
+                m_values.emplace_back(std::move(value));
+            }
+        }
+
+        std::shared_ptr<State> m_pState;
+        const std::size_t m_maxSize;
+        std::vector<ValueType> m_values{};
+    };
+
+    // The capacity is rounded up to a power of two.
+    TA_SignalStream(Sender *pSender, void (std::decay_t<Sender>::*signal)(Args...), std::size_t capacity = 1024,
+                    TA_MailboxOverflow overflow = TA_MailboxOverflow::DropOldest)
+        : m_pState(std::make_shared<State>(capacity, overflow)),
+          m_connection(TA_MetaObject::registerConnection(
+              pSender, std::move(signal),
+              [pState = m_pState](Args... args) { pState->push(ValueType(std::forward<Args>(args)...)); },
+              TA_ConnectionType::Auto)) {
+        if (!m_connection.valid()) {
+            close();
+        }
+    }
+
+    ~TA_SignalStream() { close(); }
+
+    TA_SignalStream(const TA_SignalStream &stream) = delete;
+    TA_SignalStream(TA_SignalStream &&stream) = delete;
+
+    TA_SignalStream &operator=(const TA_SignalStream &stream) = delete;
+    TA_SignalStream &operator=(TA_SignalStream &&stream) = delete;
+
+    [[nodiscard]] NextAwaiter next() { return NextAwaiter(m_pState); }
+
+    // Takes up to maxSize values at once, waiting only while the stream is empty.
+    [[nodiscard]] BatchAwaiter nextBatch(std::size_t maxSize) { return BatchAwaiter(m_pState, maxSize); }
+
+    // Disconnects from the signal. Buffered values can still be taken, a waiting consumer is resumed.
+    void close() {
+        if (m_connection.valid()) {
+            TA_MetaObject::unregisterConnection(m_connection);
+        }
+        if (!m_pState->closed.exchange(true, std::memory_order_acq_rel)) {
+            m_pState->wake();
+        }
+    }
+
+    bool isClosed() const { return m_pState->closed.load(std::memory_order_acquire); }
+    std::size_t capacity() const { return m_pState->buffer.capacity(); }
+    std::size_t droppedCount() const { return m_pState->droppedCount.load(std::memory_order_relaxed); }
+
+  private:
+    std::shared_ptr<State> m_pState;
+    TA_MetaObject::TA_ConnectionObjectHolder m_connection;
+};
+} // namespace CoreAsync
+
+#endif // TA_SIGNALSTREAM_H
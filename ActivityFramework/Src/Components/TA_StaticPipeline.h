@@ -0,0 +1,101 @@
+/*
+ * Copyright [2025] [Shuang Zhu / Sol]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TA_STATICPIPELINE_H
+#define TA_STATICPIPELINE_H
+
+#include "TA_Activity.h"
+#include "TA_TypeList.h"
+
+#include <functional>
+#include <tuple>
+#include <type_traits>
+
+namespace CoreAsync {
+/*
+ * Pipeline whose stages are fixed at compile time. The value returned by stage k is handed to stage k+1 as a plain
+ * C++ value, so nothing is boxed into a TA_DefaultVariant between stages, and a stage returning void is followed by a
+ * stage taking no parameters. run() is an ordinary nested call the compiler can inline end to end; createActivity()
+ * wraps that call into a single activity, so the whole chain costs one task when it is posted to the thread pool.
+ */
+template <typename... Stages> class TA_StaticPipeline {
+    static_assert(sizeof...(Stages) > 0, "A static pipeline needs at least one stage.");
+
+  public:
+    using StageList = TA_MetaTypelist<Stages...>;
+
+    static constexpr std::size_t stageSize{MetaSize<StageList>::value};
+
+    template <std::size_t Idx> using StageType = typename MetaTypeAt<StageList, Idx>::type;
+
+  private:
+    template <std::size_t Idx, typename... Args> static constexpr std::size_t brokenStageFrom() {
+        if constexpr (Idx == stageSize) {
+            return stageSize;
+        } else if constexpr (!std::is_invocable_v<StageType<Idx> &, Args...>) {
+            return Idx;
+        } else if constexpr (std::is_void_v<std::invoke_result_t<StageType<Idx> &, Args...>>) {
+            return brokenStageFrom<Idx + 1>();
+        } else {
+            return brokenStageFrom<Idx + 1, std::invoke_result_t<StageType<Idx> &, Args...>>();
+        }
+    }
+
+  public:
+    // Index of the first stage that cannot consume the output of its predecessor, stageSize when the chain is valid.
+    template <typename... Args> static constexpr std::size_t brokenStage{brokenStageFrom<0, Args...>()};
+
+    template <typename... Args> static constexpr bool isChainable{brokenStage<Args...> == stageSize};
+
+    constexpr explicit TA_StaticPipeline(Stages... stages) : m_stages(std::move(stages)...) {}
+
+    template <typename... Args> auto run(Args &&...args) {
+        static_assert(isChainable<Args &&...>, "The output of a stage doesn't match the parameters of the next stage.");
+        return invoke<0>(std::forward<Args>(args)...);
+    }
+
+    template <typename... Args> auto operator()(Args &&...args) { return run(std::forward<Args>(args)...); }
+
+    template <typename... Args> auto createActivity(Args... args) const {
+        static_assert(isChainable<Args &&...>, "The output of a stage doesn't match the parameters of the next stage.");
+        return TA_ActivityCreator::create(
+            [pipeline = *this, ... args = std::move(args)]() mutable { return pipeline.run(std::move(args)...); });
+    }
+
+    template <typename... Args> [[nodiscard]] TA_ActivityResultFetcher post(Args... args) const {
+        return TA_ThreadHolder::get().postActivity(createActivity(std::move(args)...), true);
+    }
+
+  private:
+    template <std::size_t Idx, typename... Args> auto invoke(Args &&...args) {
+        auto &stage{std::get<Idx>(m_stages)};
+        using Result = std::invoke_result_t<StageType<Idx> &, Args &&...>;
+        if constexpr (Idx + 1 == stageSize) {
+            return std::invoke(stage, std::forward<Args>(args)...);
+        } else if constexpr (std::is_void_v<Result>) {
+            std::invoke(stage, std::forward<Args>(args)...);
+            return invoke<Idx + 1>();
+        } else {
+            return invoke<Idx + 1>(std::invoke(stage, std::forward<Args>(args)...));
+        }
+    }
+
+  private:
+    typename StageList::Tuple m_stages;
+};
+} // namespace CoreAsync
+
+#endif // TA_STATICPIPELINE_H
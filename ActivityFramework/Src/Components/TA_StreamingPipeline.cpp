@@ -0,0 +1,274 @@
+/*
+ * Copyright [2025] [Shuang Zhu / Sol]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Components/TA_StreamingPipeline.h"
+#include "Components/TA_BoundedQueue.h"
+#include "Components/TA_Activity.h"
+#include "Components/TA_CommonTools.h"
+
+#include <cassert>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace CoreAsync {
+struct TA_StreamingPipeline::Item {
+    std::size_t sequence{0};
+    TA_DefaultVariant value{};
+    // Cleared when a stage throws, the item still travels to the end so that in-order stages see no gap.
+    bool valid{true};
+};
+
+struct TA_StreamingPipeline::Stage {
+    Stage(StageMode stageMode, StageFunction stageFunction, std::size_t capacity)
+        : mode(stageMode), function(std::move(stageFunction)), queue(capacity) {}
+
+    const StageMode mode;
+    const StageFunction function;
+    TA_BoundedQueue<Item> queue;
+    // Serial stages are owned by the worker that sets this flag, which also guards the reorder buffer.
+    std::atomic_bool active{false};
+    std::map<std::size_t, Item> reorder;
+    std::size_t nextSequence{0};
+    std::atomic_size_t processed{0};
+    std::atomic<std::int64_t> busyNanoseconds{0};
+};
+
+struct TA_StreamingPipeline::Shared {
+    explicit Shared(std::size_t tokenCount) : tokens(tokenCount), available(tokenCount) {}
+
+    std::vector<std::unique_ptr<Stage>> stages;
+    const std::size_t tokens;
+    std::atomic_size_t available;
+    std::atomic_size_t inFlight{0};
+    std::atomic_size_t nextSequence{0};
+    // Bumped on every token release and every enqueue, blocked callers wait on it.
+    std::atomic_size_t progress{0};
+    std::atomic_bool started{false};
+    std::atomic<std::int64_t> startTime{0};
+    std::mutex mutex;
+    std::exception_ptr exception{nullptr};
+};
+
+TA_StreamingPipeline::TA_StreamingPipeline(std::size_t tokens)
+    : m_pShared(std::make_shared<Shared>(std::max<std::size_t>(tokens, 1))) {}
+
+TA_StreamingPipeline::~TA_StreamingPipeline() {
+    try {
+        wait();
+    } catch (...) {
+    }
+}
+
+bool TA_StreamingPipeline::addStage(StageMode mode, StageFunction function) {
+    if (m_pShared->started.load(std::memory_order_acquire) || !function) {
+        assert(!m_pShared->started.load(std::memory_order_acquire) && function);
+        TA_CommonTools::debugInfo(META_STRING("Add stage to streaming pipeline failed!"));
+        return false;
+    }
+    m_pShared->stages.emplace_back(std::make_unique<Stage>(mode, std::move(function), m_pShared->tokens));
+    return true;
+}
+
+bool TA_StreamingPipeline::push(TA_DefaultVariant item) {
+    if (m_pShared->stages.empty()) {
+        TA_CommonTools::debugInfo(META_STRING("Push item to streaming pipeline failed!"));
+        return false;
+    }
+    acquireToken(m_pShared, true);
+    start(std::move(item));
+    return true;
+}
+
+bool TA_StreamingPipeline::tryPush(TA_DefaultVariant item) {
+    if (m_pShared->stages.empty() || !acquireToken(m_pShared, false)) {
+        return false;
+    }
+    start(std::move(item));
+    return true;
+}
+
+void TA_StreamingPipeline::wait() {
+    while (true) {
+        std::size_t progress{m_pShared->progress.load(std::memory_order_acquire)};
+        if (m_pShared->inFlight.load(std::memory_order_acquire) == 0) {
+            break;
+        }
+        if (!help(m_pShared)) {
+            m_pShared->progress.wait(progress, std::memory_order_acquire);
+        }
+    }
+    std::exception_ptr exception{nullptr};
+    {
+        std::lock_guard<std::mutex> locker(m_pShared->mutex);
+        std::swap(exception, m_pShared->exception);
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
+
+std::size_t TA_StreamingPipeline::tokens() const { return m_pShared->tokens; }
+
+std::size_t TA_StreamingPipeline::stageSize() const { return m_pShared->stages.size(); }
+
+std::size_t TA_StreamingPipeline::inFlight() const { return m_pShared->inFlight.load(std::memory_order_acquire); }
+
+TA_StreamingPipeline::StageStatistics TA_StreamingPipeline::statistics(std::size_t stage) const {
+    if (stage >= m_pShared->stages.size()) {
+        throw std::invalid_argument("Stage is out of the range of stage size");
+    }
+    const Stage &target{*m_pShared->stages[stage]};
+    StageStatistics stats;
+    stats.processed = target.processed.load(std::memory_order_acquire);
+    stats.busyTime = std::chrono::nanoseconds(target.busyNanoseconds.load(std::memory_order_acquire));
+    if (m_pShared->started.load(std::memory_order_acquire)) {
+        std::int64_t now{std::chrono::steady_clock::now().time_since_epoch().count()};
+        std::chrono::duration<double> elapsed{
+            std::chrono::steady_clock::duration(now - m_pShared->startTime.load(std::memory_order_acquire))};
+        if (elapsed.count() > 0) {
+            stats.throughput = static_cast<double>(stats.processed) / elapsed.count();
+        }
+    }
+    return stats;
+}
+
+void TA_StreamingPipeline::start(TA_DefaultVariant &&item) {
+    bool expected{false};
+    if (m_pShared->started.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+        m_pShared->startTime.store(std::chrono::steady_clock::now().time_since_epoch().count(),
+                                   std::memory_order_release);
+    }
+    m_pShared->inFlight.fetch_add(1, std::memory_order_acq_rel);
+    std::size_t sequence{m_pShared->nextSequence.fetch_add(1, std::memory_order_acq_rel)};
+    enqueue(m_pShared, 0, Item{sequence, std::move(item), true});
+}
+
+bool TA_StreamingPipeline::acquireToken(const std::shared_ptr<Shared> &pShared, bool blocking) {
+    while (true) {
+        std::size_t progress{pShared->progress.load(std::memory_order_acquire)};
+        std::size_t available{pShared->available.load(std::memory_order_acquire)};
+        while (available > 0) {
+            if (pShared->available.compare_exchange_weak(available, available - 1, std::memory_order_acq_rel)) {
+                return true;
+            }
+        }
+        if (!blocking) {
+            return false;
+        }
+        if (!help(pShared)) {
+            pShared->progress.wait(progress, std::memory_order_acquire);
+        }
+    }
+}
+
+void TA_StreamingPipeline::enqueue(const std::shared_ptr<Shared> &pShared, std::size_t stage, Item &&item) {
+    if (stage == pShared->stages.size()) {
+        pShared->inFlight.fetch_sub(1, std::memory_order_acq_rel);
+        pShared->available.fetch_add(1, std::memory_order_acq_rel);
+        notify(*pShared);
+        return;
+    }
+    Stage &target{*pShared->stages[stage]};
+    // Never fails: the queue holds at least as many cells as there are tokens.
+    [[maybe_unused]] bool pushed{target.queue.push(std::move(item))};
+    assert(pushed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    notify(*pShared);
+    // A serial stage that is already owned re-checks its queue before letting go, so no extra worker is needed.
+    if (target.mode != StageMode::Parallel && target.active.load(std::memory_order_relaxed)) {
+        return;
+    }
+    auto pActivity = TA_ActivityCreator::create([pShared, stage]() { drain(pShared, stage); });
+    [[maybe_unused]] auto fetcher = TA_ThreadHolder::get().postActivity(pActivity, true);
+}
+
+bool TA_StreamingPipeline::drain(const std::shared_ptr<Shared> &pShared, std::size_t stage) {
+    Stage &target{*pShared->stages[stage]};
+    Item item;
+    if (target.mode == StageMode::Parallel) {
+        if (!target.queue.pop(item)) {
+            return false;
+        }
+        process(*pShared, target, item);
+        enqueue(pShared, stage + 1, std::move(item));
+        return true;
+    }
+    bool worked{false};
+    while (true) {
+        bool expected{false};
+        if (!target.active.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+            return worked;
+        }
+        while (target.queue.pop(item)) {
+            worked = true;
+            if (target.mode == StageMode::SerialOutOfOrder) {
+                process(*pShared, target, item);
+                enqueue(pShared, stage + 1, std::move(item));
+                continue;
+            }
+            target.reorder.emplace(item.sequence, std::move(item));
+            for (auto it = target.reorder.begin();
+                 it != target.reorder.end() && it->first == target.nextSequence;
+                 it = target.reorder.erase(it), ++target.nextSequence) {
+                process(*pShared, target, it->second);
+                enqueue(pShared, stage + 1, std::move(it->second));
+            }
+        }
+        target.active.store(false, std::memory_order_release);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (target.queue.isEmpty()) {
+            return worked;
+        }
+    }
+}
+
+void TA_StreamingPipeline::process(Shared &shared, Stage &stage, Item &item) {
+    if (item.valid) {
+        auto begin{std::chrono::steady_clock::now()};
+        try {
+            item.value = stage.function(std::move(item.value));
+        } catch (...) {
+            item.valid = false;
+            std::lock_guard<std::mutex> locker(shared.mutex);
+            if (!shared.exception) {
+                shared.exception = std::current_exception();
+            }
+        }
+        stage.busyNanoseconds.fetch_add(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count(),
+            std::memory_order_relaxed);
+    }
+    stage.processed.fetch_add(1, std::memory_order_release);
+}
+
+bool TA_StreamingPipeline::help(const std::shared_ptr<Shared> &pShared) {
+    // Later stages first, they are the ones that hand tokens back.
+    for (std::size_t stage = pShared->stages.size(); stage > 0; --stage) {
+        if (drain(pShared, stage - 1)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void TA_StreamingPipeline::notify(Shared &shared) {
+    shared.progress.fetch_add(1, std::memory_order_acq_rel);
+    shared.progress.notify_all();
+}
+} // namespace CoreAsync
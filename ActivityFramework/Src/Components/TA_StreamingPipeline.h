@@ -0,0 +1,90 @@
+/*
+ * Copyright [2025] [Shuang Zhu / Sol]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TA_STREAMINGPIPELINE_H
+#define TA_STREAMINGPIPELINE_H
+
+#include "TA_Variant.h"
+#include "TA_ActivityFramework_global.h"
+
+#include <chrono>
+#include <functional>
+#include <memory>
+
+namespace CoreAsync {
+/*
+ * Continuous multi-stage pipeline. Items pushed into the pipeline flow through the stages in order while different
+ * stages work on different items at the same time. Adjacent stages are connected by bounded lock-free queues and the
+ * number of items inside the pipeline is capped by the token count, which also bounds the memory held by the queues.
+ *
+ * A serial stage processes one item at a time, either in push order (SerialInOrder) or in arrival order
+ * (SerialOutOfOrder); a parallel stage processes as many items as there are free workers. Threads blocked in push()
+ * or wait() take part in draining the stages, so the pipeline keeps moving even when every pool thread is a caller.
+ */
+class ACTIVITY_FRAMEWORK_EXPORT TA_StreamingPipeline {
+    struct Item;
+    struct Stage;
+    struct Shared;
+
+  public:
+    enum class StageMode { SerialInOrder, SerialOutOfOrder, Parallel };
+
+    using StageFunction = std::function<TA_DefaultVariant(TA_DefaultVariant)>;
+
+    struct StageStatistics {
+        std::size_t processed{0};
+        std::chrono::nanoseconds busyTime{0};
+        // Items per second since the first push.
+        double throughput{0.0};
+    };
+
+    explicit TA_StreamingPipeline(std::size_t tokens = 16);
+    ~TA_StreamingPipeline();
+
+    TA_StreamingPipeline(const TA_StreamingPipeline &pipeline) = delete;
+    TA_StreamingPipeline(TA_StreamingPipeline &&pipeline) = delete;
+    TA_StreamingPipeline &operator=(const TA_StreamingPipeline &) = delete;
+
+    // Stages can only be added before the first item is pushed.
+    bool addStage(StageMode mode, StageFunction function);
+
+    bool push(TA_DefaultVariant item);
+    bool tryPush(TA_DefaultVariant item);
+
+    // Blocks until every pushed item has left the last stage and rethrows the first exception thrown by a stage.
+    void wait();
+
+    std::size_t tokens() const;
+    std::size_t stageSize() const;
+    std::size_t inFlight() const;
+    StageStatistics statistics(std::size_t stage) const;
+
+  private:
+    static bool acquireToken(const std::shared_ptr<Shared> &pShared, bool blocking);
+    static void enqueue(const std::shared_ptr<Shared> &pShared, std::size_t stage, Item &&item);
+    static bool drain(const std::shared_ptr<Shared> &pShared, std::size_t stage);
+    static void process(Shared &shared, Stage &stage, Item &item);
+    static bool help(const std::shared_ptr<Shared> &pShared);
+    static void notify(Shared &shared);
+
+    void start(TA_DefaultVariant &&item);
+
+  private:
+    std::shared_ptr<Shared> m_pShared;
+};
+} // namespace CoreAsync
+
+#endif // TA_STREAMINGPIPELINE_H
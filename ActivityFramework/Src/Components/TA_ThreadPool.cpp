@@ -15,6 +15,7 @@
  */
 
 #include "TA_ThreadPool.h"
+#include "TA_EpochDomain.h"
 
 namespace CoreAsync {
 #if defined(__ANDROID__)
@@ -52,6 +53,9 @@ void  TA_ThreadPool::init() {
                 if (trySteal(pActivity, idx) && pActivity) {
                     (*pActivity)();
                 }
+                if (TA_EpochDomain::get().hasRetired()) {
+                    TA_EpochDomain::get().reclaim();
+                }
                 m_states[idx].isBusy.store(false, std::memory_order_release);
             }
             TA_CommonTools::debugInfo(META_STRING("Shut down successuflly!\n"));
@@ -106,6 +110,9 @@ void  TA_ThreadPool::init() {
                 if (trySteal(pActivity, idx) && pActivity) {
                     (*pActivity)();
                 }
+                if (TA_EpochDomain::get().hasRetired()) {
+                    TA_EpochDomain::get().reclaim();
+                }
                 m_states[idx].isBusy.store(false, std::memory_order_release);
             }
             TA_CommonTools::debugInfo(META_STRING("Shut down successuflly!\n"));
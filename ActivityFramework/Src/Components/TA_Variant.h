@@ -20,6 +20,7 @@
 #include <typeinfo>
 #include <memory>
 #include <cstring>
+#include <utility>
 
 #include "TA_CommonTools.h"
 #include "TA_MetaStringView.h"
@@ -37,6 +37,13 @@ class ITA_Connection {
         return TA_Connection::connect<type>(pSender, std::forward<SenderFunc>(sFunc), std::forward<LambdaExp>(lExp));
     }
 
+    template <ConnectionType ct = TA_ConnectionType::Auto, class Sender, typename SenderFunc, typename Receivers,
+              typename ReceiverFunc>
+    static std::size_t connectMany(Sender *pSender, SenderFunc &&sFunc, Receivers &&receivers, ReceiverFunc &&rFunc) {
+        return TA_Connection::connectMany<ct>(pSender, std::forward<SenderFunc>(sFunc),
+                                              std::forward<Receivers>(receivers), std::forward<ReceiverFunc>(rFunc));
+    }
+
     template <class Sender, typename SenderFunc, class Receiver, typename ReceiverFunc>
     static constexpr bool disconnect(Sender *pSender, SenderFunc &&sFunc, Receiver *pReceiver, ReceiverFunc &&rFunc) {
         return TA_Connection::disconnect(pSender, std::forward<SenderFunc>(sFunc), pReceiver,
@@ -41,6 +41,20 @@ class ITA_PipelineCreator {
     static TA_PipelineCreator::ManualKeyActivityChainHolder *createManualKeyActivityChainPipeline() {
         return TA_PipelineCreator::GetInstance().createManualKeyActivityChainPipeline();
     }
+
+    static TA_PipelineCreator::DagHolder *createDagPipeline() {
+        return TA_PipelineCreator::GetInstance().createDagPipeline();
+    }
+
+    template <typename Holder> static bool release(Holder *pHolder) {
+        return TA_PipelineCreator::GetInstance().release(pHolder);
+    }
+
+    static void setPoolCapacity(std::size_t capacity) { TA_PipelineCreator::GetInstance().setPoolCapacity(capacity); }
+
+    static std::size_t liveCount() { return TA_PipelineCreator::GetInstance().liveCount(); }
+
+    static std::size_t pooledCount() { return TA_PipelineCreator::GetInstance().pooledCount(); }
 };
 } // namespace CoreAsync
 
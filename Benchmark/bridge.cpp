@@ -0,0 +1,160 @@
+#include <benchmark/benchmark.h>
+
+#include "Components/TA_Connection.h"
+#include "Components/TA_SignalBridge.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include <spawn.h>
+#include <sys/wait.h>
+
+extern char **environ;
+
+// Two processes: this one emits through a TA_SignalBridgeProxy, a child started from the same binary re-emits through
+// a TA_SignalBridgeStub and answers over a second ring.
+class BridgeEndpoint : public CoreAsync::TA_MetaObject
+{
+public:
+    TA_Signals:
+    void ping(int64_t seq) { std::ignore = seq; }
+    void tick(int64_t seq) { std::ignore = seq; }
+    void pong(int64_t seq) { std::ignore = seq; }
+};
+
+DEFINE_TYPE_INFO(BridgeEndpoint)
+{
+    AUTO_META_FIELDS(
+        REGISTER_FIELD(ping),
+        REGISTER_FIELD(tick),
+        REGISTER_FIELD(pong)
+    )
+};
+
+static std::shared_ptr<CoreAsync::TA_SharedRing> g_pRequests, g_pReplies;
+static BridgeEndpoint *g_pEndpoint{nullptr};
+static std::atomic<int64_t> g_lastPong{0};
+
+// Answers every ping with its sequence number, and a negative tick with the number of ticks received so far.
+static int runChild(int requestsFd, int repliesFd)
+{
+    std::shared_ptr<CoreAsync::TA_SharedRing> pRequests = CoreAsync::TA_SharedRing::fromFd(requestsFd);
+    std::shared_ptr<CoreAsync::TA_SharedRing> pReplies = CoreAsync::TA_SharedRing::fromFd(repliesFd);
+    if (!pRequests || !pReplies) {
+        return 1;
+    }
+    BridgeEndpoint endpoint;
+    int64_t ticks{0};
+    CoreAsync::TA_SignalBridgeProxy proxy(pReplies, 1);
+    proxy.forward(&endpoint, &BridgeEndpoint::pong);
+    CoreAsync::TA_Connection::connect(&endpoint, &BridgeEndpoint::ping, [&endpoint](int64_t seq) {
+        CoreAsync::TA_Connection::active(&endpoint, &BridgeEndpoint::pong, seq);
+    });
+    CoreAsync::TA_Connection::connect(&endpoint, &BridgeEndpoint::tick, [&endpoint, &ticks](int64_t seq) {
+        if (seq >= 0) {
+            ++ticks;
+        } else {
+            CoreAsync::TA_Connection::active(&endpoint, &BridgeEndpoint::pong, -ticks);
+        }
+    });
+    CoreAsync::TA_SignalBridgeStub stub(pRequests);
+    stub.expose(&endpoint, &BridgeEndpoint::ping);
+    stub.expose(&endpoint, &BridgeEndpoint::tick);
+    while (!pRequests->isClosed() || !pRequests->isEmpty()) {
+        if (pRequests->wait(std::chrono::milliseconds(100))) {
+            stub.poll();
+        }
+    }
+    return 0;
+}
+
+static void waitPong(int64_t expected)
+{
+    while (g_lastPong.load(std::memory_order_acquire) != expected) {
+        std::this_thread::yield();
+    }
+}
+
+// Round trip of one emission to the other process and back, nothing else in flight.
+static void BM_BridgeLatency(benchmark::State &state)
+{
+    CoreAsync::TA_SignalBridgeProxy proxy(g_pRequests, 1);
+    proxy.forward(g_pEndpoint, &BridgeEndpoint::ping);
+    // Keeps counting across runs, so a pong left from an earlier run can't match.
+    static int64_t seq{0};
+    for (auto _ : state) {
+        CoreAsync::TA_Connection::active(g_pEndpoint, &BridgeEndpoint::ping, ++seq);
+        waitPong(seq);
+    }
+    state.counters["wakeups"] = static_cast<double>(g_pRequests->wakeups());
+}
+BENCHMARK(BM_BridgeLatency)->UseRealTime();
+
+// Emissions per second into the other process, with records published one by one or in batches.
+static void BM_BridgeThroughput(benchmark::State &state)
+{
+    constexpr int64_t batch{10000};
+    CoreAsync::TA_SignalBridgeProxy proxy(g_pRequests, static_cast<std::size_t>(state.range(0)));
+    proxy.forward(g_pEndpoint, &BridgeEndpoint::tick);
+    const std::uint64_t wakeups{g_pRequests->wakeups()};
+    // The child acknowledges a negative tick with the negated number of ticks it has seen.
+    g_lastPong.store(1, std::memory_order_release);
+    CoreAsync::TA_Connection::active(g_pEndpoint, &BridgeEndpoint::tick, int64_t{-1});
+    int64_t expected{1};
+    while ((expected = g_lastPong.load(std::memory_order_acquire)) > 0) {
+        std::this_thread::yield();
+    }
+    for (auto _ : state) {
+        for (int64_t value = 0; value < batch; ++value) {
+            CoreAsync::TA_Connection::active(g_pEndpoint, &BridgeEndpoint::tick, value);
+        }
+        expected -= batch;
+        CoreAsync::TA_Connection::active(g_pEndpoint, &BridgeEndpoint::tick, int64_t{-1});
+        waitPong(expected);
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+    state.counters["batches"] = static_cast<double>(proxy.batchCount());
+    state.counters["wakeups"] = static_cast<double>(g_pRequests->wakeups() - wakeups);
+}
+BENCHMARK(BM_BridgeThroughput)->Arg(1)->Arg(64)->UseRealTime();
+
+int main(int argc, char **argv)
+{
+    if (argc == 4 && std::string_view(argv[1]) == "--bridge-child") {
+        return runChild(std::atoi(argv[2]), std::atoi(argv[3]));
+    }
+    g_pRequests = CoreAsync::TA_SharedRing::createAnonymous(1 << 20);
+    g_pReplies = CoreAsync::TA_SharedRing::createAnonymous(1 << 16);
+    if (!g_pRequests || !g_pReplies) {
+        return 1;
+    }
+    // The memfd descriptors are inherited by the child.
+    std::string requestsFd{std::to_string(g_pRequests->fd())}, repliesFd{std::to_string(g_pReplies->fd())};
+    char childFlag[] = "--bridge-child";
+    char *childArgv[] = {argv[0], childFlag, requestsFd.data(), repliesFd.data(), nullptr};
+    pid_t pid{0};
+    if (posix_spawn(&pid, argv[0], nullptr, nullptr, childArgv, environ) != 0) {
+        return 1;
+    }
+
+    BridgeEndpoint endpoint;
+    g_pEndpoint = &endpoint;
+    CoreAsync::TA_Connection::connect(&endpoint, &BridgeEndpoint::pong,
+                                      [](int64_t seq) { g_lastPong.store(seq, std::memory_order_release); });
+    CoreAsync::TA_SignalBridgeStub stub(g_pReplies);
+    stub.expose(&endpoint, &BridgeEndpoint::pong);
+    stub.start();
+
+    benchmark::Initialize(&argc, argv);
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    g_pRequests->close();
+    int status{0};
+    waitpid(pid, &status, 0);
+    stub.stop();
+    return 0;
+}
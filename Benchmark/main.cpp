@@ -1,6 +1,17 @@
 #include <benchmark/benchmark.h>
 
 #include "Components/TA_Serialization.h"
+#include "Components/TA_Parallel.h"
+#include "Components/TA_AutoChainPipeline.h"
+#include "Components/TA_ManualStepsChainPipeline.h"
+#include "Components/TA_StreamingPipeline.h"
+#include "Components/TA_StaticPipeline.h"
+#include "Components/TA_ActivityCache.h"
+#include "Components/TA_Connection.h"
+
+#include <atomic>
+#include <random>
+#include <thread>
 
 #ifdef __ANDROID__
 const std::string TEST_FILE_PATH = "/data/local/tmp/test.afw";
@@ -54,4 +65,476 @@ static void BM_Deserialization(benchmark::State& state)
 }
 BENCHMARK(BM_Deserialization)->Iterations(1);
 
+static std::vector<int> randomData(std::size_t size)
+{
+    std::vector<int> data(size);
+    std::mt19937 engine{2025};
+    std::uniform_int_distribution<int> dist;
+    std::generate(data.begin(), data.end(), [&]() { return dist(engine); });
+    return data;
+}
+
+// Sizes from 1e3 to 1e8, each parallel case is paired with its std:: counterpart to give the scaling curve.
+static void ParallelRange(benchmark::internal::Benchmark *bench)
+{
+    bench->RangeMultiplier(10)->Range(1000, 100000000)->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+
+static void BM_StdSort(benchmark::State &state)
+{
+    auto source = randomData(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto data = source;
+        state.ResumeTiming();
+        std::sort(data.begin(), data.end());
+        benchmark::DoNotOptimize(data.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StdSort)->Apply(ParallelRange);
+
+static void BM_ParallelSort(benchmark::State &state)
+{
+    auto source = randomData(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto data = source;
+        state.ResumeTiming();
+        CoreAsync::TA_Parallel::sort(data.begin(), data.end());
+        benchmark::DoNotOptimize(data.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ParallelSort)->Apply(ParallelRange);
+
+static void BM_ParallelStableSort(benchmark::State &state)
+{
+    auto source = randomData(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto data = source;
+        state.ResumeTiming();
+        CoreAsync::TA_Parallel::stableSort(data.begin(), data.end());
+        benchmark::DoNotOptimize(data.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ParallelStableSort)->Apply(ParallelRange);
+
+static void BM_ParallelMerge(benchmark::State &state)
+{
+    auto lhs = randomData(state.range(0) / 2), rhs = randomData(state.range(0) - state.range(0) / 2);
+    std::sort(lhs.begin(), lhs.end());
+    std::sort(rhs.begin(), rhs.end());
+    std::vector<int> res(state.range(0));
+    for (auto _ : state) {
+        CoreAsync::TA_Parallel::merge(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), res.begin());
+        benchmark::DoNotOptimize(res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ParallelMerge)->Apply(ParallelRange);
+
+static void BM_StdInclusiveScan(benchmark::State &state)
+{
+    auto data = randomData(state.range(0));
+    std::vector<int> res(data.size());
+    for (auto _ : state) {
+        std::inclusive_scan(data.begin(), data.end(), res.begin());
+        benchmark::DoNotOptimize(res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StdInclusiveScan)->Apply(ParallelRange);
+
+static void BM_ParallelInclusiveScan(benchmark::State &state)
+{
+    auto data = randomData(state.range(0));
+    std::vector<int> res(data.size());
+    for (auto _ : state) {
+        CoreAsync::TA_Parallel::inclusiveScan(data.begin(), data.end(), res.begin());
+        benchmark::DoNotOptimize(res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ParallelInclusiveScan)->Apply(ParallelRange);
+
+static void BM_ParallelExclusiveScan(benchmark::State &state)
+{
+    auto data = randomData(state.range(0));
+    std::vector<int> res(data.size());
+    for (auto _ : state) {
+        CoreAsync::TA_Parallel::exclusiveScan(data.begin(), data.end(), res.begin(), 0);
+        benchmark::DoNotOptimize(res.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ParallelExclusiveScan)->Apply(ParallelRange);
+
+template <typename Pipeline>
+static void fillPipeline(Pipeline &pipeline, std::size_t stages)
+{
+    pipeline.reserve(stages);
+    for (std::size_t idx = 0; idx < stages; ++idx) {
+        auto activity = CoreAsync::TA_ActivityCreator::create([idx]() { return static_cast<int>(idx); });
+        pipeline.add(activity);
+    }
+}
+
+static void BM_AutoChainPipeline(benchmark::State &state)
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        CoreAsync::TA_AutoChainPipeline pipeline;
+        fillPipeline(pipeline, state.range(0));
+        state.ResumeTiming();
+        auto waiter = pipeline.execute(CoreAsync::TA_BasicPipeline::ExecuteType::Sync);
+        waiter();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AutoChainPipeline)->RangeMultiplier(10)->Range(10, 100000)->Unit(benchmark::kMillisecond);
+
+static void BM_ManualStepsChainPipeline(benchmark::State &state)
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        CoreAsync::TA_ManualStepsChainPipeline pipeline;
+        fillPipeline(pipeline, state.range(0));
+        pipeline.setSteps(state.range(0));
+        state.ResumeTiming();
+        auto waiter = pipeline.execute(CoreAsync::TA_BasicPipeline::ExecuteType::Sync);
+        waiter();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ManualStepsChainPipeline)->RangeMultiplier(10)->Range(10, 100000)->Unit(benchmark::kMillisecond);
+
+static void BM_StreamingPipeline(benchmark::State &state)
+{
+    using StageMode = CoreAsync::TA_StreamingPipeline::StageMode;
+    constexpr int items{10000};
+    for (auto _ : state) {
+        CoreAsync::TA_StreamingPipeline pipeline{static_cast<std::size_t>(state.range(0))};
+        pipeline.addStage(StageMode::SerialInOrder, [](CoreAsync::TA_DefaultVariant var) { return var; });
+        pipeline.addStage(StageMode::Parallel, [](CoreAsync::TA_DefaultVariant var) {
+            int value{var.get<int>()};
+            for (int idx = 0; idx < 1000; ++idx) {
+                value = value * 31 + idx;
+            }
+            return CoreAsync::TA_DefaultVariant{value};
+        });
+        pipeline.addStage(StageMode::SerialInOrder, [](CoreAsync::TA_DefaultVariant var) {
+            benchmark::DoNotOptimize(var.get<int>());
+            return var;
+        });
+        for (int idx = 0; idx < items; ++idx) {
+            pipeline.push(CoreAsync::TA_DefaultVariant{idx});
+        }
+        pipeline.wait();
+    }
+    state.SetItemsProcessed(state.iterations() * items);
+}
+BENCHMARK(BM_StreamingPipeline)->RangeMultiplier(4)->Range(1, 256)->Unit(benchmark::kMillisecond);
+
+static void BM_StaticPipeline(benchmark::State &state)
+{
+    CoreAsync::TA_StaticPipeline pipeline{[](int value) { return value * 3; }, [](int value) { return value + 7; },
+                                          [](int value) { return value ^ 0x5a; }};
+    int value{0};
+    for (auto _ : state) {
+        value = pipeline.run(value);
+        benchmark::DoNotOptimize(value);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_StaticPipeline);
+
+static void BM_StaticPipelineActivity(benchmark::State &state)
+{
+    CoreAsync::TA_StaticPipeline pipeline{[](int value) { return value * 3; }, [](int value) { return value + 7; },
+                                          [](int value) { return value ^ 0x5a; }};
+    for (auto _ : state) {
+        auto fetcher = pipeline.post(static_cast<int>(state.iterations()));
+        benchmark::DoNotOptimize(fetcher());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_StaticPipelineActivity);
+
+static void BM_AutoChainPipelineInstances(benchmark::State &state)
+{
+    CoreAsync::TA_AutoChainPipeline pipeline;
+    for (int idx = 0; idx < 4; ++idx) {
+        auto activity = CoreAsync::TA_ActivityCreator::create([]() {
+            auto *pInstance = CoreAsync::TA_PipelineInstance::current();
+            int value{pInstance->previous().get<int>()};
+            for (int round = 0; round < 1000; ++round) {
+                value = value * 31 + round;
+            }
+            return value;
+        });
+        pipeline.add(activity);
+    }
+    auto definition = pipeline.definition();
+    std::vector<std::shared_ptr<CoreAsync::TA_PipelineInstance>> instances(state.range(0));
+    for (auto _ : state) {
+        for (std::size_t idx = 0; idx < instances.size(); ++idx) {
+            instances[idx] = CoreAsync::TA_PipelineInstance::create(definition, CoreAsync::TA_DefaultVariant{int(idx)});
+            instances[idx]->execute();
+        }
+        for (auto &pInstance : instances) {
+            pInstance->wait();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AutoChainPipelineInstances)->RangeMultiplier(10)->Range(10, 10000)->Unit(benchmark::kMillisecond);
+
+static int expensiveDecode(int value)
+{
+    for (int round = 0; round < 10000; ++round) {
+        value = value * 31 + round;
+    }
+    return value;
+}
+
+static void BM_ActivityCache(benchmark::State &state)
+{
+    CoreAsync::TA_ActivityCache cache(4096);
+    const int keys{static_cast<int>(state.range(0))};
+    int key{0};
+    for (auto _ : state) {
+        auto fetcher = cache.postActivity(CoreAsync::TA_ActivityCreator::create(&expensiveDecode, key), true);
+        benchmark::DoNotOptimize(fetcher());
+        key = (key + 1) % keys;
+    }
+    auto statistics = cache.statistics();
+    state.counters["hits"] = static_cast<double>(statistics.hits);
+    state.counters["misses"] = static_cast<double>(statistics.misses);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ActivityCache)->RangeMultiplier(16)->Range(1, 4096);
+
+class EmitSender : public CoreAsync::TA_MetaObject
+{
+public:
+    TA_Signals : void valueChanged(int value) {}
+};
+
+class EmitReceiver : public CoreAsync::TA_MetaObject
+{
+public:
+    void onValueChanged(int value) { benchmark::DoNotOptimize(m_sum += value); }
+
+private:
+    int m_sum{0};
+};
+
+DEFINE_TYPE_INFO(EmitSender){AUTO_META_FIELDS(REGISTER_FIELD(valueChanged))};
+
+DEFINE_TYPE_INFO(EmitReceiver){AUTO_META_FIELDS(REGISTER_FIELD(onValueChanged))};
+
+// Emits have to run on the sender's thread to be dispatched in place, so they are issued in batches from there.
+static void BM_SignalEmit(benchmark::State &state)
+{
+    constexpr int batch{1000};
+    EmitSender sender;
+    std::vector<std::unique_ptr<EmitReceiver>> receivers;
+    for (int idx = 0; idx < state.range(0); ++idx) {
+        auto &receiver = receivers.emplace_back(std::make_unique<EmitReceiver>());
+        receiver->moveToThread(sender.affinityThread());
+        CoreAsync::TA_Connection::connect<CoreAsync::TA_ConnectionType::Direct>(
+            &sender, &EmitSender::valueChanged, receiver.get(), &EmitReceiver::onValueChanged);
+    }
+    for (auto _ : state) {
+        auto activity = CoreAsync::TA_ActivityCreator::create([&sender]() {
+            for (int value = 0; value < batch; ++value) {
+                CoreAsync::TA_Connection::active(&sender, &EmitSender::valueChanged, value);
+            }
+        });
+        activity->moveToThread(sender.affinityThread());
+        auto fetcher = CoreAsync::TA_ThreadHolder::get().postActivity(activity, true);
+        fetcher();
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(BM_SignalEmit)->Arg(0)->Arg(1)->Arg(8)->Arg(64)->UseRealTime();
+
+class FanOutReceiver : public CoreAsync::TA_MetaObject
+{
+public:
+    explicit FanOutReceiver(std::atomic_size_t &delivered) : m_delivered(delivered) {}
+
+    void onValueChanged(int value) { m_delivered.fetch_add(1, std::memory_order_release); }
+
+private:
+    std::atomic_size_t &m_delivered;
+};
+
+DEFINE_TYPE_INFO(FanOutReceiver){AUTO_META_FIELDS(REGISTER_FIELD(onValueChanged))};
+
+// Every receiver lives on the same worker and the emissions come from outside the pool, so all slot calls are queued.
+static void BM_SignalFanOut(benchmark::State &state)
+{
+    constexpr std::size_t batch{100};
+    auto &pool = CoreAsync::TA_ThreadHolder::get();
+    std::atomic_size_t delivered{0};
+    EmitSender sender;
+    const std::size_t worker{(sender.affinityThread() + 1) % pool.size()};
+    std::vector<std::unique_ptr<FanOutReceiver>> receivers;
+    for (int idx = 0; idx < state.range(0); ++idx) {
+        auto &receiver = receivers.emplace_back(std::make_unique<FanOutReceiver>(delivered));
+        receiver->moveToThread(worker);
+        CoreAsync::TA_Connection::connect<CoreAsync::TA_ConnectionType::Queued>(
+            &sender, &EmitSender::valueChanged, receiver.get(), &FanOutReceiver::onValueChanged);
+    }
+    std::size_t expected{0};
+    for (auto _ : state) {
+        for (std::size_t value = 0; value < batch; ++value) {
+            CoreAsync::TA_Connection::active(&sender, &EmitSender::valueChanged, static_cast<int>(value));
+        }
+        expected += batch * receivers.size();
+        while (delivered.load(std::memory_order_acquire) < expected) {
+            std::this_thread::yield();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(BM_SignalFanOut)->Arg(1)->Arg(8)->Arg(50)->UseRealTime();
+
+class BufferSender : public CoreAsync::TA_MetaObject
+{
+public:
+    TA_Signals : void bufferReady(const std::vector<int> &buffer) { std::ignore = buffer; }
+};
+
+class BufferReceiver : public CoreAsync::TA_MetaObject
+{
+public:
+    explicit BufferReceiver(std::atomic_size_t &delivered) : m_delivered(delivered) {}
+
+    void onBufferReady(const std::vector<int> &buffer)
+    {
+        benchmark::DoNotOptimize(buffer.data());
+        m_delivered.fetch_add(1, std::memory_order_release);
+    }
+
+private:
+    std::atomic_size_t &m_delivered;
+};
+
+DEFINE_TYPE_INFO(BufferSender){AUTO_META_FIELDS(REGISTER_FIELD(bufferReady))};
+
+DEFINE_TYPE_INFO(BufferReceiver){AUTO_META_FIELDS(REGISTER_FIELD(onBufferReady))};
+
+// A 1 MiB buffer fanned out to queued receivers. The emission copies it once, the receivers read the shared payload.
+static void BM_SignalLargePayload(benchmark::State &state)
+{
+    auto &pool = CoreAsync::TA_ThreadHolder::get();
+    const std::vector<int> buffer(1 << 18, 1);
+    std::atomic_size_t delivered{0};
+    BufferSender sender;
+    const std::size_t worker{(sender.affinityThread() + 1) % pool.size()};
+    std::vector<std::unique_ptr<BufferReceiver>> receivers;
+    for (int idx = 0; idx < state.range(0); ++idx) {
+        auto &receiver = receivers.emplace_back(std::make_unique<BufferReceiver>(delivered));
+        receiver->moveToThread(worker);
+        CoreAsync::TA_Connection::connect<CoreAsync::TA_ConnectionType::Queued>(
+            &sender, &BufferSender::bufferReady, receiver.get(), &BufferReceiver::onBufferReady);
+    }
+    std::size_t expected{0};
+    for (auto _ : state) {
+        CoreAsync::TA_Connection::active(&sender, &BufferSender::bufferReady, buffer);
+        expected += receivers.size();
+        while (delivered.load(std::memory_order_acquire) < expected) {
+            std::this_thread::yield();
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * buffer.size() * sizeof(int));
+}
+BENCHMARK(BM_SignalLargePayload)->Arg(1)->Arg(8)->Arg(32)->UseRealTime();
+
+// Wires one sender to receivers living on another thread, one connect call per receiver.
+static void BM_ConnectEach(benchmark::State &state)
+{
+    auto &pool = CoreAsync::TA_ThreadHolder::get();
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto sender = std::make_unique<EmitSender>();
+        const std::size_t worker{(sender->affinityThread() + 1) % pool.size()};
+        std::vector<std::unique_ptr<EmitReceiver>> receivers;
+        for (int idx = 0; idx < state.range(0); ++idx) {
+            receivers.emplace_back(std::make_unique<EmitReceiver>())->moveToThread(worker);
+        }
+        state.ResumeTiming();
+        for (auto &receiver : receivers) {
+            CoreAsync::TA_Connection::connect<CoreAsync::TA_ConnectionType::Queued>(
+                sender.get(), &EmitSender::valueChanged, receiver.get(), &EmitReceiver::onValueChanged);
+        }
+        state.PauseTiming();
+        receivers.clear();
+        sender.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ConnectEach)->Arg(100)->Arg(1000)->UseRealTime();
+
+// The same wiring with a single connectMany call.
+static void BM_ConnectMany(benchmark::State &state)
+{
+    auto &pool = CoreAsync::TA_ThreadHolder::get();
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto sender = std::make_unique<EmitSender>();
+        const std::size_t worker{(sender->affinityThread() + 1) % pool.size()};
+        std::vector<std::unique_ptr<EmitReceiver>> owners;
+        std::vector<EmitReceiver *> receivers;
+        for (int idx = 0; idx < state.range(0); ++idx) {
+            auto &receiver = owners.emplace_back(std::make_unique<EmitReceiver>());
+            receiver->moveToThread(worker);
+            receivers.emplace_back(receiver.get());
+        }
+        state.ResumeTiming();
+        CoreAsync::TA_Connection::connectMany<CoreAsync::TA_ConnectionType::Queued>(
+            sender.get(), &EmitSender::valueChanged, receivers, &EmitReceiver::onValueChanged);
+        state.PauseTiming();
+        owners.clear();
+        sender.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ConnectMany)->Arg(100)->Arg(1000)->UseRealTime();
+
+// Queued delivery of emission bursts to one receiver, through one activity per emission (0) or through its mailbox (1).
+static void BM_MailboxDelivery(benchmark::State &state)
+{
+    constexpr std::size_t batch{1000};
+    auto &pool = CoreAsync::TA_ThreadHolder::get();
+    std::atomic_size_t delivered{0};
+    EmitSender sender;
+    FanOutReceiver receiver(delivered);
+    receiver.moveToThread((sender.affinityThread() + 1) % pool.size());
+    if (state.range(0)) {
+        receiver.enableMailbox(batch);
+    }
+    CoreAsync::TA_Connection::connect<CoreAsync::TA_ConnectionType::Queued>(
+        &sender, &EmitSender::valueChanged, &receiver, &FanOutReceiver::onValueChanged);
+    std::size_t expected{0};
+    for (auto _ : state) {
+        for (std::size_t value = 0; value < batch; ++value) {
+            CoreAsync::TA_Connection::active(&sender, &EmitSender::valueChanged, static_cast<int>(value));
+        }
+        expected += batch;
+        while (delivered.load(std::memory_order_acquire) < expected) {
+            std::this_thread::yield();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(BM_MailboxDelivery)->Arg(0)->Arg(1)->UseRealTime();
+
 BENCHMARK_MAIN();
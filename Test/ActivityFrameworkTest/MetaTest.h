@@ -152,8 +152,15 @@ class CoroutineTestSender : public CoreAsync::TA_MetaObject {
     TA_Signals : void sendSignal(int a) {}
 };
 
+class BridgeTestSender : public CoreAsync::TA_MetaObject {
+  public:
+    TA_Signals : void sendValues(std::vector<int> values) {}
+};
+
 DEFINE_TYPE_INFO(CoroutineTestSender){AUTO_META_FIELDS(REGISTER_FIELD(sendSignal))};
 
+DEFINE_TYPE_INFO(BridgeTestSender){AUTO_META_FIELDS(REGISTER_FIELD(sendValues))};
+
 DEFINE_TYPE_INFO(TestA){AUTO_META_FIELDS(REGISTER_FIELD(print))};
 
 DEFINE_TYPE_INFO(TestB){AUTO_META_FIELDS(REGISTER_FIELD(deduct))};
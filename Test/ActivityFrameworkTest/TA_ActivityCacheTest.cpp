@@ -0,0 +1,110 @@
+/*
+ * Copyright [2025] [Shuang Zhu / Sol]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TA_ActivityCacheTest.h"
+#include "Components/TA_ActivityCache.h"
+
+#include <thread>
+
+namespace {
+std::atomic_int executions{0};
+
+int square(int value) {
+    ++executions;
+    return value * value;
+}
+
+int slowSquare(int value) {
+    ++executions;
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    return value * value;
+}
+} // namespace
+
+TA_ActivityCacheTest::TA_ActivityCacheTest() {}
+
+TA_ActivityCacheTest::~TA_ActivityCacheTest() {}
+
+void TA_ActivityCacheTest::SetUp() { executions.store(0); }
+
+void TA_ActivityCacheTest::TearDown() {}
+
+TEST_F(TA_ActivityCacheTest, memoizeTest) {
+    CoreAsync::TA_ActivityCache cache;
+    for (int idx = 0; idx < 3; ++idx) {
+        auto fetcher = cache.postActivity(CoreAsync::TA_ActivityCreator::create(&square, 7), true);
+        EXPECT_EQ(49, fetcher().get<int>());
+    }
+    auto fetcher = cache.postActivity(CoreAsync::TA_ActivityCreator::create(&square, 8), true);
+    EXPECT_EQ(64, fetcher().get<int>());
+    EXPECT_EQ(2, executions.load());
+    auto statistics{cache.statistics()};
+    EXPECT_EQ(2, statistics.hits);
+    EXPECT_EQ(2, statistics.misses);
+    EXPECT_EQ(0, statistics.coalesced);
+    EXPECT_EQ(2, cache.size());
+}
+
+TEST_F(TA_ActivityCacheTest, coalesceTest) {
+    CoreAsync::TA_ActivityCache cache;
+    std::vector<CoreAsync::TA_ActivityResultFetcher> fetchers;
+    for (int idx = 0; idx < 4; ++idx) {
+        fetchers.emplace_back(cache.postActivity(CoreAsync::TA_ActivityCreator::create(&slowSquare, 3), true));
+    }
+    for (auto &fetcher : fetchers) {
+        EXPECT_EQ(9, fetcher().get<int>());
+    }
+    EXPECT_EQ(1, executions.load());
+    auto statistics{cache.statistics()};
+    EXPECT_EQ(1, statistics.misses);
+    EXPECT_EQ(3, statistics.hits + statistics.coalesced);
+}
+
+TEST_F(TA_ActivityCacheTest, evictionTest) {
+    CoreAsync::TA_ActivityCache cache(2, std::chrono::milliseconds(20), 1);
+    for (int value : {1, 2, 3}) {
+        auto fetcher = cache.postActivity(CoreAsync::TA_ActivityCreator::create(&square, value), true);
+        fetcher();
+    }
+    EXPECT_EQ(2, cache.size());
+    EXPECT_EQ(1, cache.statistics().evictions);
+    auto fetcher = cache.postActivity(CoreAsync::TA_ActivityCreator::create(&square, 1), true);
+    EXPECT_EQ(1, fetcher().get<int>());
+    EXPECT_EQ(4, executions.load());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+    fetcher = cache.postActivity(CoreAsync::TA_ActivityCreator::create(&square, 1), true);
+    EXPECT_EQ(1, fetcher().get<int>());
+    EXPECT_EQ(5, executions.load());
+    cache.clear();
+    EXPECT_EQ(0, cache.size());
+}
+
+TEST_F(TA_ActivityCacheTest, slowResultTtlTest) {
+    // The computation takes longer than the ttl, which must count from the moment its result is ready.
+    CoreAsync::TA_ActivityCache cache(16, std::chrono::milliseconds(40));
+    auto fetcher = cache.postActivity(CoreAsync::TA_ActivityCreator::create(&slowSquare, 5), true);
+    EXPECT_EQ(25, fetcher().get<int>());
+    fetcher = cache.postActivity(CoreAsync::TA_ActivityCreator::create(&slowSquare, 5), true);
+    EXPECT_EQ(25, fetcher().get<int>());
+    EXPECT_EQ(1, executions.load());
+    EXPECT_EQ(1, cache.statistics().hits);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(80));
+    fetcher = cache.postActivity(CoreAsync::TA_ActivityCreator::create(&slowSquare, 5), true);
+    EXPECT_EQ(25, fetcher().get<int>());
+    EXPECT_EQ(2, executions.load());
+}
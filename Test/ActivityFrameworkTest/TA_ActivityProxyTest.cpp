@@ -52,3 +52,16 @@ TEST_F(TA_ActivityProxyTest, LambdaActivityTest) {
     auto fetcher = CoreAsync::TA_ThreadHolder::get().postActivity(pProxy);
     EXPECT_EQ(fetcher().get<int>(), 0);
 }
+
+TEST_F(TA_ActivityProxyTest, ResetTest) {
+    int count{0};
+    auto activity = CoreAsync::TA_ActivityCreator::create([&count]() -> int { return ++count; });
+    auto pProxy = std::make_shared<CoreAsync::TA_ActivityProxy>(activity);
+    EXPECT_FALSE(pProxy->reset());
+    (*pProxy)();
+    EXPECT_EQ(pProxy->result().get<int>(), 1);
+    EXPECT_TRUE(pProxy->reset());
+    EXPECT_FALSE(pProxy->isExecuted());
+    (*pProxy)();
+    EXPECT_EQ(pProxy->result().get<int>(), 2);
+}
@@ -18,7 +18,10 @@
 #include "Components/TA_Activity.h"
 #include "Components/TA_ActivityQueue.h"
 
+#include <algorithm>
+#include <numeric>
 #include <thread>
+#include <vector>
 
 TA_ActivityQueueTest::TA_ActivityQueueTest() {}
 
@@ -126,3 +129,48 @@ TEST_F(TA_ActivityQueueTest, fullTest) {
     }
     EXPECT_EQ(queue.isFull(), true);
 }
+
+TEST_F(TA_ActivityQueueTest, concurrentPushPopTest) {
+    // A small queue wraps around often, so consumers keep reaching slots that producers have claimed but not written.
+    constexpr int producerCount{4}, consumerCount{4}, valuesPerProducer{50000};
+    CoreAsync::TA_ActivityQueue<int, 16> queue;
+    std::atomic<int> popped{0};
+    std::vector<std::vector<int>> received(consumerCount);
+    std::vector<std::thread> threads;
+    for (int producer = 0; producer < producerCount; ++producer) {
+        threads.emplace_back([&queue, producer]() {
+            for (int i = 1; i <= valuesPerProducer; ++i) {
+                while (!queue.push(producer * valuesPerProducer + i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int consumer = 0; consumer < consumerCount; ++consumer) {
+        threads.emplace_back([&queue, &popped, &values = received[consumer]]() {
+            int value{0};
+            while (popped.load(std::memory_order_acquire) < producerCount * valuesPerProducer) {
+                if (queue.pop(value)) {
+                    values.emplace_back(value);
+                    popped.fetch_add(1, std::memory_order_acq_rel);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    // Every pushed value is popped exactly once, and no consumer sees an unwritten slot.
+    std::vector<int> all;
+    for (const auto &values : received) {
+        all.insert(all.end(), values.begin(), values.end());
+    }
+    std::ranges::sort(all);
+    std::vector<int> expected(producerCount * valuesPerProducer);
+    std::iota(expected.begin(), expected.end(), 1);
+    EXPECT_EQ(expected, all);
+    EXPECT_TRUE(queue.isEmpty());
+}
@@ -18,6 +18,106 @@
 #include "ITA_Connection.h"
 #include "MetaTest.h"
 
+#include "Components/TA_SignalBridge.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__) && !defined(__ANDROID__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+struct CountedPayload {
+    CountedPayload() = default;
+    CountedPayload(const CountedPayload &payload) : data(payload.data) { ++copies; }
+    CountedPayload(CountedPayload &&payload) noexcept = default;
+    CountedPayload &operator=(const CountedPayload &payload) = default;
+    CountedPayload &operator=(CountedPayload &&payload) noexcept = default;
+
+    std::vector<int> data;
+    static inline std::atomic_int copies{0};
+};
+
+class PayloadSender : public CoreAsync::TA_MetaObject {
+  public:
+    TA_Signals : void payloadReady(const CountedPayload &payload) { std::ignore = payload; }
+};
+
+DEFINE_TYPE_INFO(PayloadSender){AUTO_META_FIELDS(REGISTER_FIELD(payloadReady))};
+
+class CountingReceiver : public CoreAsync::TA_MetaObject {
+  public:
+    void count(int a, int b) { total.fetch_add(a + b); }
+
+    static inline std::atomic_int total{0};
+};
+
+DEFINE_TYPE_INFO(CountingReceiver){AUTO_META_FIELDS(REGISTER_FIELD(count))};
+
+class MailboxReceiver : public CoreAsync::TA_MetaObject {
+  public:
+    void record(int a, int b) {
+        values.emplace_back(a);
+        delivered.fetch_add(1);
+    }
+
+    std::vector<int> values;
+    std::atomic_int delivered{0};
+};
+
+DEFINE_TYPE_INFO(MailboxReceiver){AUTO_META_FIELDS(REGISTER_FIELD(record))};
+
+class DyingReceiver : public CoreAsync::TA_MetaObject {
+  public:
+    explicit DyingReceiver(std::shared_ptr<std::atomic_bool> pDestroyed) : m_pDestroyed(std::move(pDestroyed)) {}
+    ~DyingReceiver() override { m_pDestroyed->store(true); }
+
+    void record(int a, int b) { delivered.fetch_add(1); }
+
+    static inline std::atomic_int delivered{0};
+
+  private:
+    std::shared_ptr<std::atomic_bool> m_pDestroyed;
+};
+
+DEFINE_TYPE_INFO(DyingReceiver){AUTO_META_FIELDS(REGISTER_FIELD(record))};
+
+// Keeps a worker busy so that the messages posted meanwhile pile up in the mailboxes.
+// Returns once the blocking activity runs on the thread.
+static std::shared_ptr<std::atomic_bool> blockThread(std::size_t thread) {
+    auto pReleased = std::make_shared<std::atomic_bool>(false);
+    auto pStarted = std::make_shared<std::atomic_bool>(false);
+    auto activity = CoreAsync::TA_ActivityCreator::create([pReleased, pStarted]() {
+        pStarted->store(true);
+        while (!pReleased->load()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+    activity->setStolenEnabled(false);
+    activity->moveToThread(thread);
+    auto fetcher = CoreAsync::TA_ThreadHolder::get().postActivity(activity, true);
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!pStarted->load() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return pReleased;
+}
+
+static bool waitDelivered(const MailboxReceiver &receiver, int expected) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (receiver.delivered.load() < expected && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return receiver.delivered.load() == expected;
+}
+
 TA_ConnectionTest::TA_ConnectionTest() {}
 
 TA_ConnectionTest::~TA_ConnectionTest() {}
@@ -54,6 +154,30 @@ TEST_F(TA_ConnectionTest, activeTest) {
     EXPECT_TRUE(CoreAsync::ITA_Connection::active(m_pTest.get(), &MetaTest::startTest, 5, 5));
 }
 
+TEST_F(TA_ConnectionTest, multipleBasesTest) {
+    // MetaTest derives from TestA and TestB through two branches. Signals of both bases must stay apart, whichever
+    // static type they are connected and emitted through.
+    auto pPrints{std::make_shared<std::atomic_int>(0)}, pDeducts{std::make_shared<std::atomic_int>(0)};
+    ConnectionHolder printConn =
+        CoreAsync::ITA_Connection::connect(m_pTest.get(), &MetaTest::print, [pPrints]() { ++*pPrints; });
+    ConnectionHolder deductConn =
+        CoreAsync::ITA_Connection::connect(m_pTest.get(), &TestB::deduct, [pDeducts]() { ++*pDeducts; });
+    TestA *pTestA{m_pTest.get()};
+    OtherTest *pOther{m_pTest.get()};
+    EXPECT_TRUE(CoreAsync::ITA_Connection::active(pTestA, &TestA::print));
+    EXPECT_TRUE(CoreAsync::ITA_Connection::active(pOther, &TestB::deduct));
+    EXPECT_TRUE(CoreAsync::ITA_Connection::active(m_pTest.get(), &MetaTest::deduct));
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (pPrints->load() + pDeducts->load() < 3 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(1, pPrints->load());
+    EXPECT_EQ(2, pDeducts->load());
+    EXPECT_TRUE(CoreAsync::ITA_Connection::disconnect(printConn));
+    EXPECT_TRUE(CoreAsync::ITA_Connection::disconnect(deductConn));
+}
+
 TEST_F(TA_ConnectionTest, asyncActiveTest) {
     EXPECT_TRUE(CoreAsync::ITA_Connection::connect<CoreAsync::TA_ConnectionType::Queued>(
         m_pTest.get(), &MetaTest::startTest, m_pTest.get(), &MetaTest::productMM));
@@ -69,3 +193,523 @@ TEST_F(TA_ConnectionTest, lambdaExpTest) {
     EXPECT_TRUE(CoreAsync::ITA_Connection::active(m_pTest.get(), &MetaTest::startTest, 8, 8));
     EXPECT_TRUE(CoreAsync::ITA_Connection::disconnect(conn));
 }
+
+TEST_F(TA_ConnectionTest, concurrentEmitTest) {
+    constexpr int emitterSize{4}, emitSize{500};
+    std::atomic_int delivered{0};
+    ConnectionHolder conn = CoreAsync::ITA_Connection::connect(
+        m_pTest.get(), &MetaTest::startTest, [&delivered](int a, int b) { delivered.fetch_add(a * b); });
+    EXPECT_TRUE(conn.valid());
+
+    // Emitters read the connection list while it is being replaced underneath them.
+    std::atomic_bool running{true};
+    std::thread churn([this, &running]() {
+        while (running.load(std::memory_order_acquire)) {
+            ConnectionHolder extra =
+                CoreAsync::ITA_Connection::connect(m_pTest.get(), &MetaTest::startTest, [](int a, int b) {});
+            CoreAsync::ITA_Connection::disconnect(extra);
+        }
+    });
+    std::vector<std::thread> emitters;
+    for (int idx = 0; idx < emitterSize; ++idx) {
+        emitters.emplace_back([this]() {
+            for (int count = 0; count < emitSize; ++count) {
+                CoreAsync::ITA_Connection::active(m_pTest.get(), &MetaTest::startTest, 1, 1);
+            }
+        });
+    }
+    for (auto &emitter : emitters) {
+        emitter.join();
+    }
+    running.store(false, std::memory_order_release);
+    churn.join();
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (delivered.load() < emitterSize * emitSize && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(delivered.load(), emitterSize * emitSize);
+    EXPECT_TRUE(CoreAsync::ITA_Connection::disconnect(conn));
+}
+
+TEST_F(TA_ConnectionTest, batchedQueuedOrderTest) {
+    constexpr int emitSize{200};
+    std::vector<int> first, second;
+    std::atomic_int delivered{0};
+    // Both slots run on the sender's thread, so every emission from here hands them over in a single activity.
+    ConnectionHolder firstConn = CoreAsync::ITA_Connection::connect<CoreAsync::TA_ConnectionType::Queued>(
+        m_pTest.get(), &MetaTest::startTest, [&first, &delivered](int a, int b) {
+            first.emplace_back(a);
+            delivered.fetch_add(1);
+        });
+    ConnectionHolder secondConn = CoreAsync::ITA_Connection::connect<CoreAsync::TA_ConnectionType::Queued>(
+        m_pTest.get(), &MetaTest::startTest, [&second, &delivered](int a, int b) {
+            second.emplace_back(a);
+            delivered.fetch_add(1);
+        });
+    for (int idx = 0; idx < emitSize; ++idx) {
+        EXPECT_TRUE(CoreAsync::ITA_Connection::active(m_pTest.get(), &MetaTest::startTest, idx, 0));
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (delivered.load() < 2 * emitSize && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_EQ(delivered.load(), 2 * emitSize);
+    for (int idx = 0; idx < emitSize; ++idx) {
+        EXPECT_EQ(first[idx], idx);
+        EXPECT_EQ(second[idx], idx);
+    }
+    EXPECT_TRUE(CoreAsync::ITA_Connection::disconnect(firstConn));
+    EXPECT_TRUE(CoreAsync::ITA_Connection::disconnect(secondConn));
+}
+
+TEST_F(TA_ConnectionTest, conflatedTest) {
+    constexpr int emitSize{1000};
+    std::atomic_int delivered{0}, latest{-1};
+    std::atomic_bool released{false};
+    ConnectionHolder conn = CoreAsync::ITA_Connection::connect<CoreAsync::TA_ConnectionType::Conflated>(
+        m_pTest.get(), &MetaTest::startTest, [&delivered, &latest](int a, int b) {
+            latest.store(a);
+            delivered.fetch_add(1);
+        });
+    EXPECT_TRUE(conn.valid());
+
+    // Keep the receiving thread busy so that every emission lands while the first delivery is still queued.
+    auto blocker = CoreAsync::TA_ActivityCreator::create([&released]() {
+        while (!released.load()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+    blocker->setStolenEnabled(false);
+    blocker->moveToThread(m_pTest->affinityThread());
+    auto fetcher = CoreAsync::TA_ThreadHolder::get().postActivity(blocker, true);
+    for (int idx = 0; idx < emitSize; ++idx) {
+        EXPECT_TRUE(CoreAsync::ITA_Connection::active(m_pTest.get(), &MetaTest::startTest, idx, 0));
+    }
+    released.store(true);
+    fetcher();
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (delivered.load() == 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(delivered.load(), 1);
+    EXPECT_EQ(latest.load(), emitSize - 1);
+
+    EXPECT_TRUE(CoreAsync::ITA_Connection::active(m_pTest.get(), &MetaTest::startTest, emitSize, 0));
+    deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (delivered.load() < 2 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(latest.load(), emitSize);
+    EXPECT_TRUE(CoreAsync::ITA_Connection::disconnect(conn));
+}
+
+TEST_F(TA_ConnectionTest, sharedPayloadTest) {
+    auto pSender = std::make_shared<PayloadSender>();
+    std::atomic_int received{0};
+    std::size_t movedSize{0};
+    ConnectionHolder first = CoreAsync::ITA_Connection::connect(
+        pSender.get(), &PayloadSender::payloadReady,
+        [&received](const CountedPayload &payload) { received.fetch_add(payload.data.size()); });
+    ConnectionHolder second = CoreAsync::ITA_Connection::connect(
+        pSender.get(), &PayloadSender::payloadReady,
+        [&received](const CountedPayload &payload) { received.fetch_add(payload.data.size()); });
+    // The last receiver takes the payload by value and gets it moved in.
+    ConnectionHolder last = CoreAsync::ITA_Connection::connect(
+        pSender.get(), &PayloadSender::payloadReady, [&received, &movedSize](CountedPayload payload) {
+            movedSize = payload.data.size();
+            received.fetch_add(payload.data.size());
+        });
+
+    CountedPayload payload;
+    payload.data.resize(1024);
+    CountedPayload::copies.store(0);
+    EXPECT_TRUE(CoreAsync::ITA_Connection::active(pSender.get(), &PayloadSender::payloadReady, std::move(payload)));
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (received.load() < 3 * 1024 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(received.load(), 3 * 1024);
+    EXPECT_EQ(movedSize, 1024);
+    EXPECT_EQ(CountedPayload::copies.load(), 0);
+    EXPECT_TRUE(CoreAsync::ITA_Connection::disconnect(first));
+    EXPECT_TRUE(CoreAsync::ITA_Connection::disconnect(second));
+    EXPECT_TRUE(CoreAsync::ITA_Connection::disconnect(last));
+
+    // A by-value receiver ahead of another one gets a copy, the arguments are still there for the next receiver.
+    auto pFirstSize = std::make_shared<std::atomic_int>(-1);
+    auto pSecondSize = std::make_shared<std::atomic_int>(-1);
+    ConnectionHolder byValue = CoreAsync::ITA_Connection::connect(
+        pSender.get(), &PayloadSender::payloadReady,
+        [pFirstSize](CountedPayload payload) { pFirstSize->store(payload.data.size()); });
+    ConnectionHolder byReference = CoreAsync::ITA_Connection::connect(
+        pSender.get(), &PayloadSender::payloadReady,
+        [pSecondSize](const CountedPayload &payload) { pSecondSize->store(payload.data.size()); });
+    CountedPayload nextPayload;
+    nextPayload.data.resize(1024);
+    CountedPayload::copies.store(0);
+    EXPECT_TRUE(
+        CoreAsync::ITA_Connection::active(pSender.get(), &PayloadSender::payloadReady, std::move(nextPayload)));
+    deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while ((pFirstSize->load() < 0 || pSecondSize->load() < 0) && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(pFirstSize->load(), 1024);
+    EXPECT_EQ(pSecondSize->load(), 1024);
+    EXPECT_EQ(CountedPayload::copies.load(), 1);
+    EXPECT_TRUE(CoreAsync::ITA_Connection::disconnect(byValue));
+    EXPECT_TRUE(CoreAsync::ITA_Connection::disconnect(byReference));
+}
+
+TEST_F(TA_ConnectionTest, connectManyTest) {
+    constexpr int receiverSize{16};
+    auto &pool = CoreAsync::TA_ThreadHolder::get();
+    std::vector<std::shared_ptr<CountingReceiver>> owners;
+    std::vector<CountingReceiver *> receivers;
+    for (int idx = 0; idx < receiverSize; ++idx) {
+        auto &pReceiver = owners.emplace_back(std::make_shared<CountingReceiver>());
+        pReceiver->moveToThread(idx % pool.size());
+        receivers.emplace_back(pReceiver.get());
+    }
+    EXPECT_EQ(CoreAsync::ITA_Connection::connectMany<CoreAsync::TA_ConnectionType::Queued>(
+                  m_pTest.get(), &MetaTest::startTest, receivers, &CountingReceiver::count),
+              receiverSize);
+    // Receivers that are already connected are skipped.
+    EXPECT_EQ(CoreAsync::ITA_Connection::connectMany(m_pTest.get(), &MetaTest::startTest, receivers,
+                                                     &CountingReceiver::count),
+              0);
+    for (auto *pReceiver : receivers) {
+        EXPECT_TRUE(CoreAsync::TA_MetaObject::isConnectionExisted(m_pTest.get(), &MetaTest::startTest, pReceiver,
+                                                                  &CountingReceiver::count));
+    }
+
+    CountingReceiver::total.store(0);
+    EXPECT_TRUE(CoreAsync::ITA_Connection::active(m_pTest.get(), &MetaTest::startTest, 1, 2));
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (CountingReceiver::total.load() < 3 * receiverSize && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(CountingReceiver::total.load(), 3 * receiverSize);
+
+    for (auto *pReceiver : receivers) {
+        EXPECT_TRUE(CoreAsync::ITA_Connection::disconnect(m_pTest.get(), &MetaTest::startTest, pReceiver,
+                                                          &CountingReceiver::count));
+    }
+    EXPECT_FALSE(CoreAsync::TA_MetaObject::isConnectionExisted(m_pTest.get(), &MetaTest::startTest, receivers.front(),
+                                                               &CountingReceiver::count));
+}
+
+TEST_F(TA_ConnectionTest, unownedReceiverTest) {
+    // Neither object is owned by a shared_ptr, the connection has to keep addressing them directly.
+    MetaTest sender;
+    auto pReceiver = std::make_unique<CountingReceiver>();
+    pReceiver->moveToThread((sender.affinityThread() + 1) % CoreAsync::TA_ThreadHolder::get().size());
+    EXPECT_TRUE(CoreAsync::ITA_Connection::connect<CoreAsync::TA_ConnectionType::Queued>(
+        &sender, &MetaTest::startTest, pReceiver.get(), &CountingReceiver::count));
+    CountingReceiver::total.store(0);
+    EXPECT_TRUE(CoreAsync::ITA_Connection::active(&sender, &MetaTest::startTest, 1, 2));
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (CountingReceiver::total.load() < 3 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(CountingReceiver::total.load(), 3);
+    EXPECT_TRUE(CoreAsync::ITA_Connection::disconnect(&sender, &MetaTest::startTest, pReceiver.get(),
+                                                      &CountingReceiver::count));
+}
+
+TEST_F(TA_ConnectionTest, mailboxTest) {
+    constexpr int emitSize{500};
+    constexpr std::size_t quantum{64};
+    auto pReceiver = std::make_shared<MailboxReceiver>();
+    const std::size_t worker{(m_pTest->affinityThread() + 1) % CoreAsync::TA_ThreadHolder::get().size()};
+    pReceiver->moveToThread(worker);
+    EXPECT_TRUE(pReceiver->enableMailbox(1024, CoreAsync::TA_MailboxOverflow::DropNewest, quantum));
+    EXPECT_FALSE(pReceiver->enableMailbox());
+    EXPECT_TRUE(CoreAsync::ITA_Connection::connect<CoreAsync::TA_ConnectionType::Queued>(
+        m_pTest.get(), &MetaTest::startTest, pReceiver.get(), &MailboxReceiver::record));
+
+    auto pReleased = blockThread(worker);
+    for (int idx = 0; idx < emitSize; ++idx) {
+        EXPECT_TRUE(CoreAsync::ITA_Connection::active(m_pTest.get(), &MetaTest::startTest, idx, 0));
+    }
+    pReleased->store(true);
+    ASSERT_TRUE(waitDelivered(*pReceiver, emitSize));
+    for (int idx = 0; idx < emitSize; ++idx) {
+        EXPECT_EQ(pReceiver->values[idx], idx);
+    }
+    // One activity per quantum instead of one per emission.
+    EXPECT_LE(pReceiver->mailbox()->drainCount(), emitSize / quantum + 2);
+    EXPECT_EQ(pReceiver->mailbox()->droppedCount(), 0);
+}
+
+TEST_F(TA_ConnectionTest, mailboxOverflowTest) {
+    constexpr int emitSize{100}, capacity{16};
+    auto pNewest = std::make_shared<MailboxReceiver>();
+    auto pOldest = std::make_shared<MailboxReceiver>();
+    const std::size_t worker{(m_pTest->affinityThread() + 1) % CoreAsync::TA_ThreadHolder::get().size()};
+    for (auto &&[pReceiver, overflow] : {std::pair{pNewest, CoreAsync::TA_MailboxOverflow::DropNewest},
+                                         std::pair{pOldest, CoreAsync::TA_MailboxOverflow::DropOldest}}) {
+        pReceiver->moveToThread(worker);
+        EXPECT_TRUE(pReceiver->enableMailbox(capacity, overflow));
+        EXPECT_TRUE(CoreAsync::ITA_Connection::connect<CoreAsync::TA_ConnectionType::Queued>(
+            m_pTest.get(), &MetaTest::startTest, pReceiver.get(), &MailboxReceiver::record));
+    }
+
+    auto pReleased = blockThread(worker);
+    for (int idx = 0; idx < emitSize; ++idx) {
+        EXPECT_TRUE(CoreAsync::ITA_Connection::active(m_pTest.get(), &MetaTest::startTest, idx, 0));
+    }
+    pReleased->store(true);
+    ASSERT_TRUE(waitDelivered(*pNewest, capacity));
+    ASSERT_TRUE(waitDelivered(*pOldest, capacity));
+    for (int idx = 0; idx < capacity; ++idx) {
+        EXPECT_EQ(pNewest->values[idx], idx);
+        EXPECT_EQ(pOldest->values[idx], emitSize - capacity + idx);
+    }
+    EXPECT_EQ(pNewest->mailbox()->droppedCount(), emitSize - capacity);
+    EXPECT_EQ(pOldest->mailbox()->droppedCount(), emitSize - capacity);
+}
+
+TEST_F(TA_ConnectionTest, deleteLaterTest) {
+    constexpr int emitSize{20};
+    auto pDestroyed = std::make_shared<std::atomic_bool>(false);
+    auto *pReceiver = new DyingReceiver(pDestroyed);
+    const std::size_t worker{(m_pTest->affinityThread() + 1) % CoreAsync::TA_ThreadHolder::get().size()};
+    pReceiver->moveToThread(worker);
+    EXPECT_TRUE(CoreAsync::ITA_Connection::connect<CoreAsync::TA_ConnectionType::Queued>(
+        m_pTest.get(), &MetaTest::startTest, pReceiver, &DyingReceiver::record));
+    DyingReceiver::delivered.store(0);
+
+    auto pReleased = blockThread(worker);
+    for (int idx = 0; idx < emitSize; ++idx) {
+        EXPECT_TRUE(CoreAsync::ITA_Connection::active(m_pTest.get(), &MetaTest::startTest, idx, 0));
+    }
+    EXPECT_TRUE(pReceiver->deleteLater());
+    EXPECT_TRUE(CoreAsync::ITA_Connection::active(m_pTest.get(), &MetaTest::startTest, 0, 0));
+
+    // A blocked worker doesn't hold back reclamation, only running slot calls do.
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!pDestroyed->load() && std::chrono::steady_clock::now() < deadline) {
+        CoreAsync::TA_EpochDomain::get().reclaim();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_TRUE(pDestroyed->load());
+    pReleased->store(true);
+
+    // The calls queued before deleteLater() run ahead of the marker and find their connection gone.
+    auto pDrained = std::make_shared<std::atomic_bool>(false);
+    auto marker = CoreAsync::TA_ActivityCreator::create([pDrained]() { pDrained->store(true); });
+    marker->setStolenEnabled(false);
+    marker->moveToThread(worker);
+    auto fetcher = CoreAsync::TA_ThreadHolder::get().postActivity(marker, true);
+    deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!pDrained->load() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_TRUE(pDrained->load());
+    EXPECT_EQ(DyingReceiver::delivered.load(), 0);
+}
+
+#if defined(__linux__) && !defined(__ANDROID__)
+TEST_F(TA_ConnectionTest, sharedRingProcessTest) {
+    constexpr std::uint64_t recordSize{2000};
+    auto pRequests = CoreAsync::TA_SharedRing::createAnonymous(1024);
+    auto pReplies = CoreAsync::TA_SharedRing::createAnonymous(1024);
+    ASSERT_TRUE(pRequests && pReplies);
+
+    // The child only touches the mappings it inherited, it doesn't allocate or use the thread pool.
+    pid_t pid = fork();
+    ASSERT_GE(pid, 0);
+    if (pid == 0) {
+        std::uint64_t sum{0}, count{0};
+        while (count < recordSize && pRequests->wait(std::chrono::milliseconds(5000))) {
+            count += pRequests->read([&sum](std::span<const char> record) {
+                std::uint64_t value;
+                memcpy(&value, record.data(), sizeof(value));
+                sum += value;
+            });
+        }
+        while (!pReplies->write({reinterpret_cast<const char *>(&sum), sizeof(sum)})) {
+            pReplies->waitForSpace(std::chrono::milliseconds(100));
+        }
+        pReplies->publish();
+        _exit(count == recordSize ? 0 : 1);
+    }
+
+    // Far more than fits into the ring at once, so both sides have to sleep and wake each other.
+    for (std::uint64_t value = 1; value <= recordSize; ++value) {
+        while (!pRequests->write({reinterpret_cast<const char *>(&value), sizeof(value)})) {
+            pRequests->publish();
+            pRequests->waitForSpace(std::chrono::milliseconds(100));
+        }
+        if (value % 16 == 0) {
+            pRequests->publish();
+        }
+    }
+    pRequests->publish();
+    std::uint64_t sum{0};
+    ASSERT_TRUE(pReplies->wait(std::chrono::milliseconds(10000)));
+    EXPECT_EQ(pReplies->read([&sum](std::span<const char> record) { memcpy(&sum, record.data(), sizeof(sum)); }), 1);
+    EXPECT_EQ(sum, recordSize * (recordSize + 1) / 2);
+    int status{0};
+    EXPECT_EQ(waitpid(pid, &status, 0), pid);
+    EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+}
+
+TEST_F(TA_ConnectionTest, sharedRingCorruptTest) {
+    auto pRing = CoreAsync::TA_SharedRing::createAnonymous(1024);
+    ASSERT_TRUE(pRing);
+    const std::uint64_t first{0x1122334455667788}, second{0x8877665544332211};
+    ASSERT_TRUE(pRing->write({reinterpret_cast<const char *>(&first), sizeof(first)}));
+    ASSERT_TRUE(pRing->write({reinterpret_cast<const char *>(&second), sizeof(second)}));
+    pRing->publish();
+
+    // A second mapping plays a faulty producer and breaks the size of the second record.
+    struct stat info{};
+    ASSERT_EQ(fstat(pRing->fd(), &info), 0);
+    const std::size_t segmentSize{static_cast<std::size_t>(info.st_size)};
+    auto *pSegment =
+        static_cast<char *>(mmap(nullptr, segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, pRing->fd(), 0));
+    ASSERT_NE(pSegment, MAP_FAILED);
+    const char *pSecondBytes = reinterpret_cast<const char *>(&second);
+    char *pSecond = std::search(pSegment, pSegment + segmentSize, pSecondBytes, pSecondBytes + sizeof(second));
+    ASSERT_NE(pSecond, pSegment + segmentSize);
+    const std::uint32_t corruptSize{1 << 20};
+    memcpy(pSecond - sizeof(corruptSize), &corruptSize, sizeof(corruptSize));
+
+    std::vector<std::uint64_t> values;
+    EXPECT_EQ(pRing->read([&values](std::span<const char> record) {
+        std::uint64_t value;
+        memcpy(&value, record.data(), sizeof(value));
+        values.emplace_back(value);
+    }), 1);
+    EXPECT_EQ(values, std::vector<std::uint64_t>{first});
+    // The rest can't be framed anymore, it is dropped and the ring is closed.
+    EXPECT_TRUE(pRing->isClosed());
+    EXPECT_TRUE(pRing->isEmpty());
+    EXPECT_FALSE(pRing->wait(std::chrono::milliseconds(1)));
+
+    // A segment whose capacity isn't a power of two is refused. The capacity follows the magic number.
+    std::uint64_t capacity{0};
+    memcpy(&capacity, pSegment + sizeof(std::uint64_t), sizeof(capacity));
+    capacity += 8;
+    ASSERT_EQ(ftruncate(pRing->fd(), static_cast<off_t>(segmentSize + 8)), 0);
+    memcpy(pSegment + sizeof(std::uint64_t), &capacity, sizeof(capacity));
+    EXPECT_FALSE(CoreAsync::TA_SharedRing::fromFd(dup(pRing->fd())));
+    munmap(pSegment, segmentSize);
+}
+
+TEST_F(TA_ConnectionTest, signalBridgeTest) {
+    constexpr int emitSize{300};
+    std::shared_ptr<CoreAsync::TA_SharedRing> pRing = CoreAsync::TA_SharedRing::createAnonymous(4096);
+    ASSERT_TRUE(pRing);
+    // Both ends live in this process here, the ring is the same as between two processes.
+    CoreAsync::TA_SignalBridgeProxy proxy(pRing, 16);
+    EXPECT_TRUE(proxy.forward(m_pTest.get(), &MetaTest::startTest));
+    MetaTest localSender;
+    CoreAsync::TA_SignalBridgeStub stub(pRing);
+    EXPECT_TRUE(stub.expose(&localSender, &MetaTest::startTest));
+    EXPECT_FALSE(stub.expose(&localSender, &MetaTest::startTest));
+    auto pReceiver = std::make_shared<MailboxReceiver>();
+    EXPECT_TRUE(CoreAsync::ITA_Connection::connect<CoreAsync::TA_ConnectionType::Queued>(
+        &localSender, &MetaTest::startTest, pReceiver.get(), &MailboxReceiver::record));
+    EXPECT_TRUE(stub.start());
+
+    for (int idx = 0; idx < emitSize; ++idx) {
+        EXPECT_TRUE(CoreAsync::ITA_Connection::active(m_pTest.get(), &MetaTest::startTest, idx, 0));
+    }
+    ASSERT_TRUE(waitDelivered(*pReceiver, emitSize));
+    for (int idx = 0; idx < emitSize; ++idx) {
+        EXPECT_EQ(pReceiver->values[idx], idx);
+    }
+    stub.stop();
+    EXPECT_EQ(proxy.sentCount(), emitSize);
+    EXPECT_EQ(proxy.droppedCount(), 0);
+    EXPECT_EQ(stub.receivedCount(), emitSize);
+    EXPECT_EQ(stub.unknownCount(), 0);
+    // Records are published in batches of up to 16.
+    EXPECT_GE(proxy.batchCount(), emitSize / 16);
+    EXPECT_LE(proxy.batchCount(), emitSize);
+}
+
+TEST_F(TA_ConnectionTest, signalBridgeBlockTimeoutTest) {
+    constexpr std::size_t emitSize{5};
+    // Room for two records and nobody reading them, as if the peer had died.
+    std::shared_ptr<CoreAsync::TA_SharedRing> pRing = CoreAsync::TA_SharedRing::createAnonymous(64);
+    ASSERT_TRUE(pRing);
+    CoreAsync::TA_SignalBridgeProxy proxy(pRing, 1, CoreAsync::TA_MailboxOverflow::Block,
+                                          std::chrono::milliseconds(400));
+    EXPECT_TRUE(proxy.forward(m_pTest.get(), &MetaTest::startTest));
+
+    const auto begin = std::chrono::steady_clock::now();
+    for (std::size_t idx = 0; idx < emitSize; ++idx) {
+        EXPECT_TRUE(CoreAsync::ITA_Connection::active(m_pTest.get(), &MetaTest::startTest, 1, 2));
+    }
+    auto deadline = begin + std::chrono::seconds(10);
+    while (proxy.sentCount() + proxy.droppedCount() < emitSize && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(proxy.sentCount(), 2);
+    EXPECT_EQ(proxy.droppedCount(), emitSize - 2);
+    // Only the first emission that found the ring full waited for the deadline.
+    EXPECT_LT(std::chrono::steady_clock::now() - begin, std::chrono::milliseconds(1000));
+}
+
+TEST_F(TA_ConnectionTest, signalBridgeBadRecordTest) {
+    std::shared_ptr<CoreAsync::TA_SharedRing> pRing = CoreAsync::TA_SharedRing::createAnonymous(4096);
+    ASSERT_TRUE(pRing);
+    MetaTest localSender;
+    BridgeTestSender valueSender;
+    CoreAsync::TA_SignalBridgeStub stub(pRing);
+    EXPECT_TRUE(stub.expose(&localSender, &MetaTest::startTest));
+    EXPECT_TRUE(stub.expose(&valueSender, &BridgeTestSender::sendValues));
+    // The same name with other argument types is another channel.
+    const std::uint64_t testChannel{CoreAsync::bridgeChannel<MetaTest>(&MetaTest::startTest)};
+    const std::uint64_t valuesChannel{CoreAsync::bridgeChannel<BridgeTestSender>(&BridgeTestSender::sendValues)};
+    EXPECT_NE(testChannel, CoreAsync::bridgeChannel<CoroutineTestSender>(&CoroutineTestSender::sendSignal, "startTest"));
+
+    auto pFirst = std::make_shared<std::atomic_int>(0);
+    auto pSum = std::make_shared<std::atomic_int>(0);
+    auto testConnection = CoreAsync::TA_MetaObject::registerConnection(
+        &localSender, &MetaTest::startTest, [pFirst](int a, int b) { pFirst->store(a); },
+        CoreAsync::TA_ConnectionType::Queued);
+    auto valuesConnection = CoreAsync::TA_MetaObject::registerConnection(
+        &valueSender, &BridgeTestSender::sendValues,
+        [pSum](std::vector<int> values) { pSum->store(std::accumulate(values.begin(), values.end(), 0)); },
+        CoreAsync::TA_ConnectionType::Queued);
+
+    auto send = [&pRing](const auto &...values) {
+        std::vector<char> record;
+        {
+            CoreAsync::TA_Serializer<CoreAsync::MemoryBufferWriter> writer(record);
+            ((writer << values), ...);
+        }
+        EXPECT_TRUE(pRing->write(record));
+        pRing->publish();
+    };
+    // Too short for a channel, a missing argument, a trailing byte, and a vector claiming 2^40 elements.
+    send(std::uint8_t{1});
+    send(testChannel, 1);
+    send(testChannel, 1, 2, std::uint8_t{0});
+    send(valuesChannel, std::uint64_t{1} << 40, 7);
+    send(testChannel, 3, 4);
+    send(valuesChannel, std::vector<int>{5, 6});
+
+    EXPECT_EQ(stub.poll(), 6);
+    EXPECT_EQ(stub.receivedCount(), 2);
+    EXPECT_EQ(stub.badCount(), 4);
+    EXPECT_EQ(stub.unknownCount(), 0);
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while ((pFirst->load() == 0 || pSum->load() == 0) && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(pFirst->load(), 3);
+    EXPECT_EQ(pSum->load(), 11);
+    CoreAsync::TA_MetaObject::unregisterConnection(testConnection);
+    CoreAsync::TA_MetaObject::unregisterConnection(valuesConnection);
+}
+#endif
@@ -17,6 +17,9 @@
 #include "TA_CoroutineTest.h"
 #include "Components/TA_Connection.h"
 
+#include <chrono>
+#include <thread>
+
 TA_CoroutineTest::TA_CoroutineTest() {}
 
 TA_CoroutineTest::~TA_CoroutineTest() {}
@@ -56,3 +59,55 @@ TEST_F(TA_CoroutineTest, testCoroutineGenerator) {
     EXPECT_EQ(r2, 12);
     EXPECT_EQ(r3, 15);
 }
+
+TEST_F(TA_CoroutineTest, testSignalStream) {
+    constexpr int emitSize{200};
+    SignalStream stream(m_sender.get(), &CoroutineTestSender::sendSignal, 64, CoreAsync::TA_MailboxOverflow::Block);
+    // One connection serves every await, emissions made while the consumer is busy are buffered.
+    auto task = sumSignalStream(stream, emitSize);
+    for (int idx = 1; idx <= emitSize; ++idx) {
+        CoreAsync::TA_Connection::active(m_sender.get(), &CoroutineTestSender::sendSignal, idx);
+    }
+    EXPECT_EQ(task.get(), emitSize * (emitSize + 1) / 2);
+    EXPECT_EQ(stream.droppedCount(), 0);
+
+    auto endTask = waitSignalStreamEnd(stream);
+    stream.close();
+    EXPECT_TRUE(endTask.get());
+}
+
+TEST_F(TA_CoroutineTest, testSignalStreamBlockOnConsumerThread) {
+    SignalStream stream(m_sender.get(), &CoroutineTestSender::sendSignal, 1, CoreAsync::TA_MailboxOverflow::Block);
+    auto pResult = std::make_shared<std::atomic_int>(0);
+    // Runs on the sender's thread, so the stream's slot is called in place by the consumer's own emissions.
+    auto activity = CoreAsync::TA_ActivityCreator::create([this, &stream, pResult]() -> void {
+        pResult->store(consumeOwnEmissions(stream, m_sender.get()).get(), std::memory_order_release);
+    });
+    activity->setStolenEnabled(false);
+    activity->moveToThread(m_sender->affinityThread());
+    auto fetcher = CoreAsync::TA_ThreadHolder::get().postActivity(activity, true);
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (pResult->load(std::memory_order_acquire) == 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(pResult->load(), 12);
+    EXPECT_EQ(stream.droppedCount(), 1);
+}
+
+TEST_F(TA_CoroutineTest, testSignalStreamBatch) {
+    constexpr int emitSize{100}, capacity{16};
+    SignalStream stream(m_sender.get(), &CoroutineTestSender::sendSignal, capacity);
+    for (int idx = 0; idx < emitSize; ++idx) {
+        CoreAsync::TA_Connection::active(m_sender.get(), &CoroutineTestSender::sendSignal, idx);
+    }
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (stream.droppedCount() < emitSize - capacity && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    // The oldest emissions were dropped to make room for the newest ones.
+    auto values = takeSignalBatch(stream, emitSize).get();
+    ASSERT_EQ(values.size(), capacity);
+    for (int idx = 0; idx < capacity; ++idx) {
+        EXPECT_EQ(values[idx], emitSize - capacity + idx);
+    }
+}
@@ -18,7 +18,9 @@
 #define TA_COROUTINETEST_H
 
 #include "gtest/gtest.h"
+#include "Components/TA_Connection.h"
 #include "Components/TA_Coroutine.h"
+#include "Components/TA_SignalStream.h"
 #include "MetaTest.h"
 
 class TA_CoroutineTest : public ::testing::Test {
@@ -45,6 +47,39 @@ class TA_CoroutineTest : public ::testing::Test {
         co_return;
     }
 
+    using SignalStream = CoreAsync::TA_SignalStream<CoroutineTestSender, int>;
+
+    CoreAsync::TA_ManualCoroutineTask<int, CoreAsync::Eager> sumSignalStream(SignalStream &stream, int size) {
+        int sum{0};
+        for (int idx = 0; idx < size; ++idx) {
+            auto value = co_await stream.next();
+            sum += value.value_or(0);
+        }
+        co_return sum;
+    }
+
+    CoreAsync::TA_ManualCoroutineTask<std::vector<int>, CoreAsync::Eager> takeSignalBatch(SignalStream &stream,
+                                                                                          std::size_t maxSize) {
+        co_return co_await stream.nextBatch(maxSize);
+    }
+
+    // Emits on the thread it consumes on, the emission that finds the ring full cannot wait for room.
+    CoreAsync::TA_ManualCoroutineTask<int, CoreAsync::Eager> consumeOwnEmissions(SignalStream &stream,
+                                                                                 CoroutineTestSender *pSender) {
+        CoreAsync::TA_Connection::active(pSender, &CoroutineTestSender::sendSignal, 1);
+        auto first = co_await stream.next();
+        CoreAsync::TA_Connection::active(pSender, &CoroutineTestSender::sendSignal, 2);
+        CoreAsync::TA_Connection::active(pSender, &CoroutineTestSender::sendSignal, 3);
+        CoreAsync::TA_Connection::active(pSender, &CoroutineTestSender::sendSignal, 4);
+        auto second = co_await stream.next();
+        co_return first.value_or(0) * 10 + second.value_or(0);
+    }
+
+    CoreAsync::TA_ManualCoroutineTask<bool, CoreAsync::Eager> waitSignalStreamEnd(SignalStream &stream) {
+        auto value = co_await stream.next();
+        co_return !value.has_value();
+    }
+
     std::size_t m_count{0};
     std::shared_ptr<CoroutineTestSender> m_sender{nullptr};
 };
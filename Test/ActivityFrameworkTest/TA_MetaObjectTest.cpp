@@ -17,8 +17,49 @@
 #include "TA_MetaObjectTest.h"
 #include "MetaTest.h"
 #include "Components/TA_MetaObject.h"
+#include "Components/TA_Rebalancer.h"
+#include "ITA_Connection.h"
 #include "gtest/gtest.h"
 
+#include <chrono>
+#include <thread>
+
+class HotReceiver : public CoreAsync::TA_MetaObject {
+  public:
+    void work(int a, int b) {
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+        delivered.fetch_add(1);
+    }
+
+    std::atomic_int delivered{0};
+};
+
+DEFINE_TYPE_INFO(HotReceiver){AUTO_META_FIELDS(REGISTER_FIELD(work))};
+
+static bool emitAndWait(MetaTest *pSender, const std::vector<std::shared_ptr<HotReceiver>> &receivers, int emitSize) {
+    std::vector<int> expected;
+    for (auto &pReceiver : receivers) {
+        expected.emplace_back(pReceiver->delivered.load() + emitSize);
+    }
+    for (int idx = 0; idx < emitSize; ++idx) {
+        CoreAsync::ITA_Connection::active(pSender, &MetaTest::startTest, idx, 0);
+    }
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    for (std::size_t idx = 0; idx < receivers.size(); ++idx) {
+        while (receivers[idx]->delivered.load() < expected[idx] && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        if (receivers[idx]->delivered.load() != expected[idx]) {
+            return false;
+        }
+        // A call stays in flight until its group has returned, which is shortly after the slot.
+        while (receivers[idx]->hasQueuedCalls() && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+    }
+    return true;
+}
+
 TA_MetaObjectTest::TA_MetaObjectTest() {}
 
 TA_MetaObjectTest::~TA_MetaObjectTest() {}
@@ -37,3 +78,102 @@ TEST_F(TA_MetaObjectTest, InvokeMethodTest) {
     auto fetcher_4 = CoreAsync::TA_MetaObject::invokeMethod(&MetaTest::printStr, m_str);
     fetcher_4();
 }
+
+TEST_F(TA_MetaObjectTest, RebalanceTest) {
+    auto &rebalancer = CoreAsync::TA_Rebalancer::get();
+    const auto defaultOptions = rebalancer.options();
+    rebalancer.setOptions({1.5, std::chrono::microseconds{1}, 4, 0.0});
+    rebalancer.resetMetrics();
+
+    const std::size_t worker{(m_pMetaTest->affinityThread() + 1) % CoreAsync::TA_ThreadHolder::get().size()};
+    std::vector<std::shared_ptr<HotReceiver>> receivers{std::make_shared<HotReceiver>(),
+                                                        std::make_shared<HotReceiver>()};
+    for (auto &pReceiver : receivers) {
+        pReceiver->moveToThread(worker);
+        EXPECT_TRUE(CoreAsync::ITA_Connection::connect<CoreAsync::TA_ConnectionType::Queued>(
+            m_pMetaTest.get(), &MetaTest::startTest, pReceiver.get(), &HotReceiver::work));
+        EXPECT_TRUE(rebalancer.track(pReceiver));
+    }
+    EXPECT_FALSE(rebalancer.track(receivers.front()));
+    EXPECT_EQ(rebalancer.trackedCount(), 2);
+
+    // Both hot objects share a worker, one of them moves to an idle one.
+    ASSERT_TRUE(emitAndWait(m_pMetaTest.get(), receivers, 20));
+    EXPECT_TRUE(rebalancer.rebalance());
+    EXPECT_NE(receivers[0]->affinityThread(), receivers[1]->affinityThread());
+    auto decisions = rebalancer.decisions();
+    ASSERT_EQ(decisions.size(), 1);
+    EXPECT_EQ(decisions.back().from, worker);
+    EXPECT_NE(decisions.back().to, worker);
+    EXPECT_EQ(decisions.back().messages, 20);
+    EXPECT_TRUE(decisions.back().migrated);
+
+    // Each worker now carries one of them, moving either would only move the hot spot.
+    const std::size_t first{receivers[0]->affinityThread()}, second{receivers[1]->affinityThread()};
+    for (int pass = 0; pass < 3; ++pass) {
+        ASSERT_TRUE(emitAndWait(m_pMetaTest.get(), receivers, 20));
+        EXPECT_FALSE(rebalancer.rebalance());
+    }
+    EXPECT_EQ(receivers[0]->affinityThread(), first);
+    EXPECT_EQ(receivers[1]->affinityThread(), second);
+    auto metrics = rebalancer.metrics();
+    EXPECT_EQ(metrics.passes, 4);
+    EXPECT_EQ(metrics.migrations, 1);
+    EXPECT_EQ(metrics.threadLoads.size(), CoreAsync::TA_ThreadHolder::get().size());
+
+    for (auto &pReceiver : receivers) {
+        EXPECT_TRUE(rebalancer.untrack(pReceiver.get()));
+        EXPECT_FALSE(pReceiver->isSlotLoadSampled());
+        CoreAsync::ITA_Connection::disconnect(m_pMetaTest.get(), &MetaTest::startTest, pReceiver.get(),
+                                              &HotReceiver::work);
+    }
+    EXPECT_EQ(rebalancer.trackedCount(), 0);
+    rebalancer.setOptions(defaultOptions);
+}
+
+class BlockingReceiver : public CoreAsync::TA_MetaObject {
+  public:
+    void work(int a, int b) {
+        while (!released.load()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        delivered.fetch_add(1);
+    }
+
+    std::atomic_bool released{false};
+    std::atomic_int delivered{0};
+};
+
+DEFINE_TYPE_INFO(BlockingReceiver){AUTO_META_FIELDS(REGISTER_FIELD(work))};
+
+TEST_F(TA_MetaObjectTest, TryMoveToThreadTest) {
+    const std::size_t worker{(m_pMetaTest->affinityThread() + 1) % CoreAsync::TA_ThreadHolder::get().size()};
+    const std::size_t target{(worker + 1) % CoreAsync::TA_ThreadHolder::get().size()};
+    auto pReceiver = std::make_shared<BlockingReceiver>();
+    pReceiver->moveToThread(worker);
+    EXPECT_TRUE(CoreAsync::ITA_Connection::connect<CoreAsync::TA_ConnectionType::Queued>(
+        m_pMetaTest.get(), &MetaTest::startTest, pReceiver.get(), &BlockingReceiver::work));
+
+    // The first call holds the worker, the move is queued behind it and the second call behind the move.
+    CoreAsync::ITA_Connection::active(m_pMetaTest.get(), &MetaTest::startTest, 1, 0);
+    EXPECT_TRUE(pReceiver->hasQueuedCalls());
+    std::atomic_bool moved{true};
+    std::thread mover([&]() { moved.store(pReceiver->tryMoveToThread(target)); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    CoreAsync::ITA_Connection::active(m_pMetaTest.get(), &MetaTest::startTest, 2, 0);
+    pReceiver->released.store(true);
+    mover.join();
+    EXPECT_FALSE(moved.load());
+    EXPECT_EQ(pReceiver->affinityThread(), worker);
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while ((pReceiver->delivered.load() < 2 || pReceiver->hasQueuedCalls()) &&
+           std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(pReceiver->delivered.load(), 2);
+    EXPECT_TRUE(pReceiver->tryMoveToThread(target));
+    EXPECT_EQ(pReceiver->affinityThread(), target);
+    CoreAsync::ITA_Connection::disconnect(m_pMetaTest.get(), &MetaTest::startTest, pReceiver.get(),
+                                          &BlockingReceiver::work);
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright [2025] [Shuang Zhu / Sol]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TA_ParallelTest.h"
+#include "Components/TA_Parallel.h"
+
+#include <random>
+
+TA_ParallelTest::TA_ParallelTest() {}
+
+TA_ParallelTest::~TA_ParallelTest() {}
+
+void TA_ParallelTest::SetUp() {
+    std::mt19937 engine{2025};
+    std::uniform_int_distribution<int> dist{-1000, 1000};
+    data.resize(CoreAsync::TA_Parallel::sequentialThreshold * 10 + 17);
+    std::generate(data.begin(), data.end(), [&]() { return dist(engine); });
+}
+
+void TA_ParallelTest::TearDown() { data.clear(); }
+
+TEST_F(TA_ParallelTest, sortTest) {
+    auto expected = data;
+    std::sort(expected.begin(), expected.end());
+    CoreAsync::TA_Parallel::sort(data.begin(), data.end());
+    EXPECT_EQ(data, expected);
+}
+
+TEST_F(TA_ParallelTest, sortSmallRangeTest) {
+    std::vector<int> vec{5, 3, 9, 1, 7};
+    CoreAsync::TA_Parallel::sort(vec.begin(), vec.end(), std::greater<>{});
+    EXPECT_EQ(vec, std::vector<int>({9, 7, 5, 3, 1}));
+}
+
+TEST_F(TA_ParallelTest, stableSortTest) {
+    std::vector<std::pair<int, std::size_t>> vec(data.size());
+    for (std::size_t idx = 0; idx < data.size(); ++idx) {
+        vec[idx] = {data[idx] % 16, idx};
+    }
+    auto expected = vec;
+    auto comp = [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; };
+    std::stable_sort(expected.begin(), expected.end(), comp);
+    CoreAsync::TA_Parallel::stableSort(vec.begin(), vec.end(), comp);
+    EXPECT_EQ(vec, expected);
+}
+
+TEST_F(TA_ParallelTest, mergeTest) {
+    std::vector<int> lhs(data.begin(), data.begin() + data.size() / 3), rhs(data.begin() + data.size() / 3, data.end());
+    std::sort(lhs.begin(), lhs.end());
+    std::sort(rhs.begin(), rhs.end());
+    std::vector<int> expected(data.size()), res(data.size());
+    std::merge(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), expected.begin());
+    auto end = CoreAsync::TA_Parallel::merge(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), res.begin());
+    EXPECT_EQ(end, res.end());
+    EXPECT_EQ(res, expected);
+}
+
+TEST_F(TA_ParallelTest, inclusiveScanTest) {
+    std::vector<long long> expected(data.size()), res(data.size());
+    std::inclusive_scan(data.begin(), data.end(), expected.begin(), std::plus<long long>{}, 0LL);
+    CoreAsync::TA_Parallel::inclusiveScan(data.begin(), data.end(), res.begin());
+    EXPECT_EQ(res, expected);
+}
+
+TEST_F(TA_ParallelTest, exclusiveScanTest) {
+    std::vector<long long> expected(data.size()), res(data.size());
+    std::exclusive_scan(data.begin(), data.end(), expected.begin(), 10LL);
+    CoreAsync::TA_Parallel::exclusiveScan(data.begin(), data.end(), res.begin(), 10LL);
+    EXPECT_EQ(res, expected);
+}
+
+// Composition of the affine maps x -> a * x + b, applying the left one first. Associative, but not commutative.
+struct AffineMap {
+    std::uint32_t a{1}, b{0};
+    bool operator==(const AffineMap &) const = default;
+};
+
+static AffineMap compose(const AffineMap &first, const AffineMap &second) {
+    return {second.a * first.a, second.a * first.b + second.b};
+}
+
+TEST_F(TA_ParallelTest, nonCommutativeScanTest) {
+    std::vector<AffineMap> maps(data.size());
+    std::transform(data.begin(), data.end(), maps.begin(), [](int value) {
+        return AffineMap{static_cast<std::uint32_t>(value) | 1u, static_cast<std::uint32_t>(value)};
+    });
+    std::vector<AffineMap> expected(maps.size()), res(maps.size());
+    std::inclusive_scan(maps.begin(), maps.end(), expected.begin(), compose);
+    CoreAsync::TA_Parallel::inclusiveScan(maps.begin(), maps.end(), res.begin(), compose);
+    EXPECT_EQ(res, expected);
+
+    const AffineMap init{3, 5};
+    std::exclusive_scan(maps.begin(), maps.end(), expected.begin(), init, compose);
+    CoreAsync::TA_Parallel::exclusiveScan(maps.begin(), maps.end(), res.begin(), init, compose);
+    EXPECT_EQ(res, expected);
+}
+
+TEST_F(TA_ParallelTest, parallelForExceptionTest) {
+    EXPECT_THROW(CoreAsync::TA_Parallel::parallelFor(64,
+                                                     [](std::size_t idx) {
+                                                         if (idx == 42)
+                                                             throw std::runtime_error("failed");
+                                                     }),
+                 std::runtime_error);
+}
@@ -18,6 +18,53 @@
 #include "Components/TA_Activity.h"
 #include "ITA_PipelineCreator.h"
 
+#include <thread>
+
+namespace {
+struct DelayAwaitable {
+    std::chrono::milliseconds delay;
+
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> handle) const {
+        std::thread([handle, delay = delay]() {
+            std::this_thread::sleep_for(delay);
+            handle.resume();
+        }).detach();
+    }
+    void await_resume() const noexcept {}
+};
+
+CoreAsync::TA_BasicPipeline::SuspendableStage delayedStage(int value) {
+    co_await DelayAwaitable{std::chrono::milliseconds(20)};
+    co_return value;
+}
+
+std::atomic_int stageAttempts{0};
+std::atomic_int runningAttempts{0};
+
+// The first attempt stalls until it is asked to stop, any later attempt returns at once.
+int stallingStage(int value) {
+    ++runningAttempts;
+    if (stageAttempts++ == 0) {
+        auto token{CoreAsync::TA_BasicPipeline::stopToken()};
+        for (int round = 0; round < 2000 && !token.stop_requested(); ++round) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        --runningAttempts;
+        return -1;
+    }
+    --runningAttempts;
+    return value;
+}
+
+CoreAsync::TA_ContinuableTask<int> awaitPipeline(CoreAsync::TA_BasicPipeline *pPipeline) {
+    co_await pPipeline->execute();
+    int res{0};
+    pPipeline->result(1, res);
+    co_return res;
+}
+} // namespace
+
 TA_PipelineTest::TA_PipelineTest() {}
 
 TA_PipelineTest::~TA_PipelineTest() {}
@@ -29,6 +76,7 @@ void TA_PipelineTest::SetUp() {
     m_pManualKeyActivityChainPipeline = std::make_shared<CoreAsync::TA_ManualKeyActivityChainPipeline>();
     m_pManualStepsChainPipeline = std::make_shared<CoreAsync::TA_ManualStepsChainPipeline>();
     m_pConcurrentPipeline = std::make_shared<CoreAsync::TA_ConcurrentPipeline>();
+    m_pDagPipeline = std::make_shared<CoreAsync::TA_DagPipeline>();
 }
 
 void TA_PipelineTest::TearDown() {}
@@ -158,6 +206,205 @@ TEST_F(TA_PipelineTest, autoChainPipeline_executeTest) {
     EXPECT_EQ(9, res_2);
 }
 
+TEST_F(TA_PipelineTest, autoChainPipeline_suspendableStageTest) {
+    auto activity_1 = CoreAsync::TA_ActivityCreator::create(&MetaTest::sub, m_pTest, 1, 2);
+    auto activity_2 = CoreAsync::TA_ActivityCreator::create(&delayedStage, 7);
+    auto activity_3 = CoreAsync::TA_ActivityCreator::create(&MetaTest::sub, m_pTest, 10, 1);
+
+    m_pAutoChainPipeline->add(activity_1, activity_2, activity_3);
+    auto waiter = m_pAutoChainPipeline->execute();
+    waiter();
+    EXPECT_TRUE(waiter.isDone());
+    EXPECT_EQ(CoreAsync::TA_BasicPipeline::State::Ready, m_pAutoChainPipeline->state());
+    int res_0, res_1, res_2;
+    m_pAutoChainPipeline->result(0, res_0);
+    m_pAutoChainPipeline->result(1, res_1);
+    m_pAutoChainPipeline->result(2, res_2);
+    EXPECT_EQ(-1, res_0);
+    EXPECT_EQ(7, res_1);
+    EXPECT_EQ(9, res_2);
+}
+
+TEST_F(TA_PipelineTest, autoChainPipeline_awaitTest) {
+    auto activity_1 = CoreAsync::TA_ActivityCreator::create(&MetaTest::sub, m_pTest, 1, 2);
+    auto activity_2 = CoreAsync::TA_ActivityCreator::create(&delayedStage, 5);
+    m_pAutoChainPipeline->add(activity_1, activity_2);
+
+    std::atomic_bool finished{false};
+    auto task = awaitPipeline(m_pAutoChainPipeline.get());
+    task.start([&finished]() {
+        finished.store(true);
+        finished.notify_all();
+    });
+    finished.wait(false);
+    EXPECT_EQ(5, task.result().value_or(0));
+
+    m_pAutoChainPipeline->reset();
+    std::atomic_bool called{false};
+    auto waiter = m_pAutoChainPipeline->execute();
+    waiter.then([&called]() {
+        called.store(true);
+        called.notify_all();
+    });
+    called.wait(false);
+    EXPECT_TRUE(waiter.isDone());
+}
+
+TEST_F(TA_PipelineTest, autoChainPipeline_hedgingTest) {
+    stageAttempts.store(0);
+    auto activity_1 = CoreAsync::TA_ActivityCreator::create(&MetaTest::sub, m_pTest, 1, 2);
+    auto activity_2 = CoreAsync::TA_ActivityCreator::create(&stallingStage, 11);
+    m_pAutoChainPipeline->add(activity_1, activity_2);
+    m_pAutoChainPipeline->setStagePolicy(1, {true, std::chrono::milliseconds(20), std::chrono::milliseconds(0)});
+
+    const auto start{std::chrono::steady_clock::now()};
+    m_pAutoChainPipeline->execute()();
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+    int res{0};
+    m_pAutoChainPipeline->result(1, res);
+    EXPECT_EQ(11, res);
+    EXPECT_EQ(2, stageAttempts.load());
+    while (runningAttempts.load() != 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+TEST_F(TA_PipelineTest, autoChainPipeline_stageTimeoutTest) {
+    stageAttempts.store(0);
+    auto activity_1 = CoreAsync::TA_ActivityCreator::create(&stallingStage, 11);
+    auto activity_2 = CoreAsync::TA_ActivityCreator::create(&MetaTest::sub, m_pTest, 10, 1);
+    m_pAutoChainPipeline->add(activity_1, activity_2);
+    m_pAutoChainPipeline->setStagePolicy(0, {false, std::chrono::milliseconds(0), std::chrono::milliseconds(30)});
+
+    const auto start{std::chrono::steady_clock::now()};
+    auto waiter = m_pAutoChainPipeline->execute();
+    waiter();
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+    EXPECT_EQ(CoreAsync::TA_BasicPipeline::State::Ready, m_pAutoChainPipeline->state());
+    CoreAsync::TA_BasicPipeline::StageTimeout timeout;
+    EXPECT_TRUE(m_pAutoChainPipeline->result(0, timeout));
+    int res{0};
+    m_pAutoChainPipeline->result(1, res);
+    EXPECT_EQ(9, res);
+    EXPECT_EQ(1, stageAttempts.load());
+    while (runningAttempts.load() != 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+TEST_F(TA_PipelineTest, stagePolicy_concurrentAndDagTest) {
+    // The concurrent and DAG pipelines run their stages without the chain runner, the policy must still apply.
+    for (auto pPipeline : std::initializer_list<CoreAsync::TA_BasicPipeline *>{m_pConcurrentPipeline.get(),
+                                                                               m_pDagPipeline.get()}) {
+        stageAttempts.store(0);
+        auto activity_1 = CoreAsync::TA_ActivityCreator::create(&stallingStage, 11);
+        auto activity_2 = CoreAsync::TA_ActivityCreator::create(&MetaTest::sub, m_pTest, 10, 1);
+        pPipeline->add(activity_1, activity_2);
+        pPipeline->setStagePolicy(0, {false, std::chrono::milliseconds(0), std::chrono::milliseconds(30)});
+
+        const auto start{std::chrono::steady_clock::now()};
+        pPipeline->execute()();
+        EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+        CoreAsync::TA_BasicPipeline::StageTimeout timeout;
+        EXPECT_TRUE(pPipeline->result(0, timeout));
+        int res{0};
+        EXPECT_TRUE(pPipeline->result(1, res));
+        EXPECT_EQ(9, res);
+        while (runningAttempts.load() != 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+}
+
+TEST_F(TA_PipelineTest, stagePolicy_removeTest) {
+    auto activity_1 = CoreAsync::TA_ActivityCreator::create(&MetaTest::sub, m_pTest, 1, 1);
+    auto activity_2 = CoreAsync::TA_ActivityCreator::create(&MetaTest::sub, m_pTest, 2, 1);
+    auto activity_3 = CoreAsync::TA_ActivityCreator::create(&MetaTest::sub, m_pTest, 3, 1);
+    m_pAutoChainPipeline->add(activity_1, activity_2, activity_3);
+    m_pAutoChainPipeline->setStagePolicy(0, {false, std::chrono::milliseconds(0), std::chrono::milliseconds(10)});
+    m_pAutoChainPipeline->setStagePolicy(2, {true, std::chrono::milliseconds(5), std::chrono::milliseconds(30)});
+
+    // The policy of the last stage follows it to its new index, the removed stage's policy is gone.
+    EXPECT_TRUE(m_pAutoChainPipeline->remove(0));
+    EXPECT_EQ(std::chrono::milliseconds(0), m_pAutoChainPipeline->stagePolicy(0).timeout);
+    auto policy = m_pAutoChainPipeline->stagePolicy(1);
+    EXPECT_TRUE(policy.hedging);
+    EXPECT_EQ(std::chrono::milliseconds(5), policy.hedgeAfter);
+    EXPECT_EQ(std::chrono::milliseconds(30), policy.timeout);
+    EXPECT_EQ(std::chrono::milliseconds(0), m_pAutoChainPipeline->stagePolicy(2).timeout);
+}
+
+TEST_F(TA_PipelineTest, autoChainPipeline_instanceTest) {
+    auto activity_1 = CoreAsync::TA_ActivityCreator::create(
+        []() { return CoreAsync::TA_PipelineInstance::current()->input().get<int>() * 2; });
+    auto activity_2 = CoreAsync::TA_ActivityCreator::create(
+        []() { return CoreAsync::TA_PipelineInstance::current()->previous().get<int>() + 1; });
+    auto activity_3 = CoreAsync::TA_ActivityCreator::create(&delayedStage, 3);
+    m_pAutoChainPipeline->add(activity_1, activity_2, activity_3);
+
+    auto definition = m_pAutoChainPipeline->definition();
+    std::vector<std::shared_ptr<CoreAsync::TA_PipelineInstance>> instances;
+    for (int i = 0; i < 64; ++i) {
+        instances.emplace_back(CoreAsync::TA_PipelineInstance::create(definition, CoreAsync::TA_DefaultVariant{i}));
+        EXPECT_TRUE(instances.back()->execute());
+    }
+    for (int i = 0; i < 64; ++i) {
+        instances[i]->wait();
+        int res_0, res_1, res_2;
+        instances[i]->result(0, res_0);
+        instances[i]->result(1, res_1);
+        instances[i]->result(2, res_2);
+        EXPECT_EQ(i * 2, res_0);
+        EXPECT_EQ(i * 2 + 1, res_1);
+        EXPECT_EQ(3, res_2);
+    }
+    EXPECT_EQ(CoreAsync::TA_BasicPipeline::State::Waiting, m_pAutoChainPipeline->state());
+
+    auto instance = m_pAutoChainPipeline->createInstance(CoreAsync::TA_DefaultVariant{10});
+    instance->execute(CoreAsync::TA_BasicPipeline::ExecuteType::Sync);
+    instance->wait();
+    int res{0};
+    EXPECT_TRUE(instance->result(1, res));
+    EXPECT_EQ(21, res);
+    EXPECT_EQ(nullptr, CoreAsync::TA_PipelineInstance::current());
+}
+
+TEST_F(TA_PipelineTest, autoChainPipeline_instanceExceptionTest) {
+    auto activity_1 = CoreAsync::TA_ActivityCreator::create(
+        []() { return CoreAsync::TA_PipelineInstance::current()->input().get<int>() * 2; });
+    auto activity_2 = CoreAsync::TA_ActivityCreator::create([]() -> int { throw std::runtime_error("Stage failed"); });
+    auto activity_3 = CoreAsync::TA_ActivityCreator::create([]() { return 3; });
+    m_pAutoChainPipeline->add(activity_1, activity_2, activity_3);
+    auto definition = m_pAutoChainPipeline->definition();
+
+    auto instance = CoreAsync::TA_PipelineInstance::create(definition, CoreAsync::TA_DefaultVariant{4});
+    EXPECT_TRUE(instance->execute());
+    instance->wait();
+    EXPECT_TRUE(instance->exception());
+    EXPECT_EQ(1, instance->stage());
+    int res{0};
+    EXPECT_TRUE(instance->result(0, res));
+    EXPECT_EQ(8, res);
+    EXPECT_FALSE(instance->result(2, res) && res == 3);
+
+    // A failing run nested in a stage of another instance hands the outer instance back to that stage.
+    auto pOuterPipeline = std::make_shared<CoreAsync::TA_AutoChainPipeline>();
+    auto nested = CoreAsync::TA_ActivityCreator::create([definition]() {
+        auto *pOuter = CoreAsync::TA_PipelineInstance::current();
+        auto inner = CoreAsync::TA_PipelineInstance::create(definition, CoreAsync::TA_DefaultVariant{1});
+        inner->execute(CoreAsync::TA_BasicPipeline::ExecuteType::Sync);
+        return inner->isDone() && inner->exception() && CoreAsync::TA_PipelineInstance::current() == pOuter;
+    });
+    pOuterPipeline->add(nested);
+    auto outer = pOuterPipeline->createInstance(CoreAsync::TA_DefaultVariant{0});
+    outer->execute(CoreAsync::TA_BasicPipeline::ExecuteType::Sync);
+    bool restored{false};
+    EXPECT_TRUE(outer->result(0, restored));
+    EXPECT_TRUE(restored);
+    EXPECT_FALSE(outer->exception());
+    EXPECT_EQ(nullptr, CoreAsync::TA_PipelineInstance::current());
+}
+
 TEST_F(TA_PipelineTest, manualChainPipeline_executeTest) {
     auto activity_1 = CoreAsync::TA_ActivityCreator::create(&MetaTest::sub, m_pTest, 1, 2);
     auto activity_2 = CoreAsync::TA_ActivityCreator::create(&MetaTest::sub, m_pTest, 5, 2);
@@ -234,6 +481,84 @@ TEST_F(TA_PipelineTest, manualStepsChainPipeline_executeTest) {
     EXPECT_EQ(0, res_2);
 }
 
+TEST_F(TA_PipelineTest, manualStepsChainPipeline_checkpointTest) {
+    const std::string path{"./steps_checkpoint.afw"};
+    EXPECT_TRUE(CoreAsync::TA_PipelineCheckpoint::registerType<int>(1));
+    EXPECT_TRUE(CoreAsync::TA_PipelineCheckpoint::registerType<std::vector<int>>(2));
+    std::atomic_int executed{0};
+    auto fill = [&executed](CoreAsync::TA_ManualStepsChainPipeline &pipeline) {
+        auto activity_1 = CoreAsync::TA_ActivityCreator::create([&executed]() { return ++executed, 1; });
+        auto activity_2 = CoreAsync::TA_ActivityCreator::create([&executed]() { return ++executed, std::vector<int>{2, 2}; });
+        auto activity_3 = CoreAsync::TA_ActivityCreator::create([&executed]() { return ++executed, 3; });
+        pipeline.add(activity_1, activity_2, activity_3);
+    };
+    {
+        CoreAsync::TA_ManualStepsChainPipeline pipeline;
+        fill(pipeline);
+        pipeline.setSteps(2);
+        pipeline.setCheckpoint(path, 2);
+        pipeline.execute()();
+    }
+    EXPECT_EQ(2, executed.load());
+
+    CoreAsync::TA_ManualStepsChainPipeline resumed;
+    fill(resumed);
+    EXPECT_TRUE(resumed.resume(path));
+    EXPECT_EQ(2, resumed.startIndex());
+    EXPECT_EQ(2, resumed.steps());
+    resumed.execute()();
+    EXPECT_EQ(3, executed.load());
+    int res_0{0}, res_2{0};
+    std::vector<int> res_1;
+    resumed.result(0, res_0);
+    resumed.result(1, res_1);
+    resumed.result(2, res_2);
+    EXPECT_EQ(1, res_0);
+    EXPECT_EQ(std::vector<int>({2, 2}), res_1);
+    EXPECT_EQ(3, res_2);
+    EXPECT_EQ(CoreAsync::TA_BasicPipeline::State::Ready, resumed.state());
+    EXPECT_TRUE(CoreAsync::TA_PipelineCheckpoint::remove(path));
+    EXPECT_FALSE(resumed.resume(path));
+}
+
+TEST_F(TA_PipelineTest, manualKeyActivityChainPipeline_checkpointTest) {
+    const std::string path{"./key_checkpoint.afw"};
+    CoreAsync::TA_PipelineCheckpoint::registerType<int>(1);
+    std::atomic_int executed{0};
+    auto fill = [&executed](CoreAsync::TA_ManualKeyActivityChainPipeline &pipeline) {
+        auto activity_1 = CoreAsync::TA_ActivityCreator::create([&executed]() { return ++executed, 1; });
+        auto activity_2 = CoreAsync::TA_ActivityCreator::create([&executed]() { return ++executed, 2; });
+        auto activity_3 = CoreAsync::TA_ActivityCreator::create([&executed]() { return ++executed, 3; });
+        pipeline.add(activity_1, activity_2, activity_3);
+    };
+    {
+        CoreAsync::TA_ManualKeyActivityChainPipeline pipeline;
+        fill(pipeline);
+        pipeline.setKeyActivity(1);
+        pipeline.setCheckpoint(path);
+        pipeline.execute()();
+        pipeline.execute()();
+    }
+    EXPECT_EQ(2, executed.load());
+
+    CoreAsync::TA_ManualKeyActivityChainPipeline resumed;
+    fill(resumed);
+    EXPECT_TRUE(resumed.resume(path));
+    EXPECT_EQ(1, resumed.keyIndex());
+    resumed.execute()();
+    EXPECT_EQ(2, executed.load());
+    resumed.skipKeyActivity();
+    resumed.execute()();
+    resumed.execute()();
+    EXPECT_EQ(3, executed.load());
+    int res_1{0}, res_2{0};
+    resumed.result(1, res_1);
+    resumed.result(2, res_2);
+    EXPECT_EQ(2, res_1);
+    EXPECT_EQ(3, res_2);
+    CoreAsync::TA_PipelineCheckpoint::remove(path);
+}
+
 TEST_F(TA_PipelineTest, parallelPipeline_executeTest) {
     std::function<bool()> testFunc = [&]() -> bool {
        auto activity_1 = CoreAsync::TA_ActivityCreator::create(&MetaTest::sub, m_pTest, 1, 2);
@@ -287,3 +612,299 @@ TEST_F(TA_PipelineTest, parallelPipeline_executeTest) {
     //     EXPECT_EQ(true,res);
     // }
 }
+
+TEST_F(TA_PipelineTest, parallelPipeline_boundedReduceTest) {
+    std::atomic_int running{0}, peak{0};
+    for (int i = 1; i <= 16; ++i) {
+        auto activity = CoreAsync::TA_ActivityCreator::create([i, &running, &peak]() {
+            int now{running.fetch_add(1) + 1};
+            int prev{peak.load()};
+            while (prev < now && !peak.compare_exchange_weak(prev, now)) {
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            running.fetch_sub(1);
+            return i;
+        });
+        m_pConcurrentPipeline->add(activity);
+    }
+    m_pConcurrentPipeline->setMaxInFlight(2);
+    m_pConcurrentPipeline->setReducer(
+        [](const CoreAsync::TA_DefaultVariant &acc, const CoreAsync::TA_DefaultVariant &var) {
+            return CoreAsync::TA_DefaultVariant{acc.get<int>() + var.get<int>()};
+        },
+        CoreAsync::TA_DefaultVariant{0});
+    auto waiter = m_pConcurrentPipeline->execute(CoreAsync::TA_BasicPipeline::ExecuteType::Async);
+    waiter();
+    int sum{0};
+    EXPECT_TRUE(m_pConcurrentPipeline->reducedResult(sum));
+    EXPECT_EQ(136, sum);
+    EXPECT_LE(peak.load(), 2);
+}
+
+TEST_F(TA_PipelineTest, dagPipeline_executeTest) {
+    auto activity_1 = CoreAsync::TA_ActivityCreator::create(&MetaTest::sub, m_pTest, 10, 1);
+    auto activity_2 = CoreAsync::TA_ActivityCreator::create(&MetaTest::sub, m_pTest, 5, 2);
+    m_pDagPipeline->add(activity_1, activity_2);
+    auto sum = m_pDagPipeline->addNode(
+        [](const CoreAsync::TA_DagPipeline::ParentResults &parents) {
+            return parents[0].get<int>() + parents[1].get<int>();
+        },
+        {0, 1});
+    auto twice = m_pDagPipeline->addNode(
+        [](const CoreAsync::TA_DagPipeline::ParentResults &parents) { return parents[0].get<int>() * 2; }, {sum});
+    EXPECT_EQ(4, m_pDagPipeline->activitySize());
+    auto invalid = m_pDagPipeline->addNode(
+        [](const CoreAsync::TA_DagPipeline::ParentResults &) { return 0; }, {twice + 1});
+    EXPECT_EQ(4, invalid);
+    EXPECT_EQ(4, m_pDagPipeline->activitySize());
+    EXPECT_FALSE(m_pDagPipeline->setPredecessors(0, {twice}));
+    EXPECT_TRUE(m_pDagPipeline->predecessors(0).empty());
+
+    for (int round = 0; round < 2; ++round) {
+        auto waiter = m_pDagPipeline->execute();
+        waiter();
+        int res_0, res_1, res_2, res_3;
+        {
+            m_pDagPipeline->result(0, res_0);
+            m_pDagPipeline->result(1, res_1);
+            m_pDagPipeline->result(2, res_2);
+            m_pDagPipeline->result(3, res_3);
+        }
+        EXPECT_EQ(CoreAsync::TA_BasicPipeline::State::Ready, m_pDagPipeline->state());
+        EXPECT_EQ(9, res_0);
+        EXPECT_EQ(3, res_1);
+        EXPECT_EQ(12, res_2);
+        EXPECT_EQ(24, res_3);
+        m_pDagPipeline->reset();
+    }
+}
+
+TEST_F(TA_PipelineTest, dagPipeline_profileTest) {
+    CoreAsync::TA_PipelineHolder<CoreAsync::TA_DagPipeline> holder;
+    auto sleep = [](int milliseconds) {
+        return [milliseconds](const CoreAsync::TA_DagPipeline::ParentResults &) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds));
+            return milliseconds;
+        };
+    };
+    auto fast = holder.addNode(sleep(1));
+    auto slow = holder.addNode(sleep(40));
+    auto join = holder.addNode(sleep(1), {fast, slow});
+    EXPECT_EQ(nullptr, holder.profile());
+    holder.setProfilingEnabled(true);
+    holder.execute()();
+
+    auto pProfile{holder.profile()};
+    ASSERT_NE(nullptr, pProfile);
+    auto runs{pProfile->runs()};
+    ASSERT_EQ(1, runs.size());
+    EXPECT_LE(runs[0].enqueue, runs[0].start);
+    EXPECT_LE(runs[0].start, runs[0].finish);
+    for (const auto &stage : runs[0].stages) {
+        EXPECT_TRUE(stage.isFinished());
+        EXPECT_LE(stage.enqueue, stage.start);
+    }
+    auto report{pProfile->report()};
+    EXPECT_EQ(1, report.runs);
+    ASSERT_EQ(3, report.stages.size());
+    EXPECT_GE(report.stages[slow].minExecution, std::chrono::milliseconds(40));
+    EXPECT_EQ(std::vector<CoreAsync::TA_BasicPipeline::ActivityIndex>({slow, join}), report.criticalPath);
+    EXPECT_GE(report.criticalPathTime, std::chrono::milliseconds(40));
+}
+
+TEST_F(TA_PipelineTest, autoChainPipeline_profileTest) {
+    auto activity_1 = CoreAsync::TA_ActivityCreator::create(&MetaTest::sub, m_pTest, 1, 2);
+    auto activity_2 = CoreAsync::TA_ActivityCreator::create(&MetaTest::sub, m_pTest, 5, 2);
+    m_pAutoChainPipeline->add(activity_1, activity_2);
+    m_pAutoChainPipeline->setProfilingEnabled(true);
+    m_pAutoChainPipeline->execute()();
+    m_pAutoChainPipeline->reset();
+    m_pAutoChainPipeline->execute()();
+
+    auto report{m_pAutoChainPipeline->profile()->report()};
+    EXPECT_EQ(2, report.runs);
+    ASSERT_EQ(2, report.stages.size());
+    EXPECT_EQ(2, report.stages[1].samples);
+    EXPECT_LE(report.stages[1].minExecution, report.stages[1].p99Execution);
+    EXPECT_EQ(std::vector<CoreAsync::TA_BasicPipeline::ActivityIndex>({0, 1}), report.criticalPath);
+    m_pAutoChainPipeline->setProfilingEnabled(false);
+    EXPECT_EQ(nullptr, m_pAutoChainPipeline->profile());
+}
+
+TEST_F(TA_PipelineTest, autoChainPipeline_profileSuspendTest) {
+    auto activity_1 = CoreAsync::TA_ActivityCreator::create(&MetaTest::sub, m_pTest, 1, 2);
+    auto activity_2 = CoreAsync::TA_ActivityCreator::create(&delayedStage, 7);
+    auto activity_3 = CoreAsync::TA_ActivityCreator::create(&MetaTest::sub, m_pTest, 5, 2);
+    m_pAutoChainPipeline->add(activity_1, activity_2, activity_3);
+    m_pAutoChainPipeline->setProfilingEnabled(true);
+    m_pAutoChainPipeline->execute()();
+
+    auto runs{m_pAutoChainPipeline->profile()->runs()};
+    ASSERT_EQ(1, runs.size());
+    const auto &stages{runs[0].stages};
+    ASSERT_EQ(3, stages.size());
+    // The first stage waited for the runner, each later one for the stage before it.
+    EXPECT_EQ(runs[0].enqueue, stages[0].enqueue);
+    EXPECT_LE(stages[0].enqueue, stages[0].start);
+    EXPECT_EQ(stages[0].finish, stages[1].enqueue);
+    EXPECT_EQ(stages[1].finish, stages[2].enqueue);
+    // The suspendable stage lasts until its coroutine completes.
+    EXPECT_GE(stages[1].finish - stages[1].start, std::chrono::milliseconds(20));
+    for (const auto &stage : stages) {
+        EXPECT_TRUE(stage.isFinished());
+        EXPECT_LE(stage.start, stage.finish);
+    }
+    m_pAutoChainPipeline->setProfilingEnabled(false);
+}
+
+TEST_F(TA_PipelineTest, dagPipeline_removeTest) {
+    std::atomic_int count{0};
+    for (int i = 0; i < 4; ++i) {
+        m_pDagPipeline->addNode([&count](const CoreAsync::TA_DagPipeline::ParentResults &) { return ++count; });
+    }
+    m_pDagPipeline->setPredecessors(3, {1, 2});
+    m_pDagPipeline->setPredecessors(2, {0});
+    m_pDagPipeline->remove(1);
+    EXPECT_EQ(3, m_pDagPipeline->activitySize());
+    EXPECT_EQ(std::vector<CoreAsync::TA_BasicPipeline::ActivityIndex>({1}), m_pDagPipeline->predecessors(2));
+
+    auto waiter = m_pDagPipeline->execute(CoreAsync::TA_BasicPipeline::ExecuteType::Sync);
+    waiter();
+    int res_2;
+    m_pDagPipeline->result(2, res_2);
+    EXPECT_EQ(3, count.load());
+    EXPECT_EQ(3, res_2);
+}
+
+TEST_F(TA_PipelineTest, removeResultTest) {
+    auto activity_1 = CoreAsync::TA_ActivityCreator::create(&MetaTest::sub, m_pTest, 1, 2);
+    auto activity_2 = CoreAsync::TA_ActivityCreator::create(&MetaTest::sub, m_pTest, 2, 2);
+    auto activity_3 = CoreAsync::TA_ActivityCreator::create(&MetaTest::sub, m_pTest, 10, 1);
+
+    m_pAutoChainPipeline->reserve(3);
+    m_pAutoChainPipeline->add(activity_1, activity_2, activity_3);
+    m_pAutoChainPipeline->remove(1);
+    auto waiter = m_pAutoChainPipeline->execute();
+    waiter();
+    int res_0, res_1;
+    EXPECT_TRUE(m_pAutoChainPipeline->result(0, res_0));
+    EXPECT_TRUE(m_pAutoChainPipeline->result(1, res_1));
+    EXPECT_FALSE(m_pAutoChainPipeline->result(2, res_1));
+    EXPECT_EQ(-1, res_0);
+    EXPECT_EQ(9, res_1);
+}
+
+TEST_F(TA_PipelineTest, pipelineCreator_recycleTest) {
+    // Drops the holders pooled by earlier tests.
+    CoreAsync::ITA_PipelineCreator::setPoolCapacity(0);
+    CoreAsync::ITA_PipelineCreator::setPoolCapacity(1);
+    auto live{CoreAsync::ITA_PipelineCreator::liveCount()};
+
+    auto pFirst = CoreAsync::ITA_PipelineCreator::createConcurrentPipeline();
+    auto pSecond = CoreAsync::ITA_PipelineCreator::createConcurrentPipeline();
+    EXPECT_EQ(live + 2, CoreAsync::ITA_PipelineCreator::liveCount());
+    pFirst->setMaxInFlight(2);
+    auto activity = CoreAsync::TA_ActivityCreator::create(&MetaTest::sub, m_pTest, 3, 1);
+    pFirst->add(activity);
+    pFirst->execute(CoreAsync::TA_BasicPipeline::ExecuteType::Sync)();
+    EXPECT_EQ(CoreAsync::TA_BasicPipeline::State::Ready, pFirst->state());
+
+    EXPECT_TRUE(CoreAsync::ITA_PipelineCreator::release(pFirst));
+    EXPECT_FALSE(CoreAsync::ITA_PipelineCreator::release(pFirst));
+    EXPECT_TRUE(CoreAsync::ITA_PipelineCreator::release(pSecond));
+    EXPECT_EQ(live, CoreAsync::ITA_PipelineCreator::liveCount());
+    EXPECT_EQ(1, CoreAsync::ITA_PipelineCreator::pooledCount());
+
+    auto pReused = CoreAsync::ITA_PipelineCreator::createConcurrentPipeline();
+    EXPECT_EQ(pFirst, pReused);
+    EXPECT_EQ(CoreAsync::TA_BasicPipeline::State::Waiting, pReused->state());
+    EXPECT_EQ(0, pReused->activitySize());
+    EXPECT_TRUE(CoreAsync::ITA_PipelineCreator::release(pReused));
+    CoreAsync::ITA_PipelineCreator::setPoolCapacity(16);
+}
+
+TEST_F(TA_PipelineTest, nestedPipeline_fanOutTest) {
+    // More branches than workers: a branch that held a worker while its chain runs would starve the pool.
+    constexpr int branchCount{16};
+    std::vector<std::shared_ptr<CoreAsync::TA_AutoChainPipeline>> branches;
+    for (int i = 0; i < branchCount; ++i) {
+        auto pBranch{std::make_shared<CoreAsync::TA_AutoChainPipeline>()};
+        auto delayed = CoreAsync::TA_ActivityCreator::create([i]() { return delayedStage(i); });
+        auto doubled = CoreAsync::TA_ActivityCreator::create([i]() { return i * 2; });
+        pBranch->add(delayed, doubled);
+        auto pChild{pBranch.get()};
+        m_pConcurrentPipeline->add(pChild);
+        branches.emplace_back(pBranch);
+    }
+    m_pConcurrentPipeline->setReducer(
+        [](const CoreAsync::TA_DefaultVariant &acc, const CoreAsync::TA_DefaultVariant &var) {
+            return CoreAsync::TA_DefaultVariant{acc.get<int>() + var.get<int>()};
+        },
+        CoreAsync::TA_DefaultVariant{0});
+
+    auto pFanOut{m_pConcurrentPipeline.get()};
+    auto join = CoreAsync::TA_ActivityCreator::create([pFanOut]() {
+        int sum{0};
+        pFanOut->reducedResult(sum);
+        return sum + 1;
+    });
+    m_pAutoChainPipeline->add(pFanOut, join);
+    m_pAutoChainPipeline->execute()();
+
+    int fanOut{0}, joined{0};
+    EXPECT_TRUE(m_pAutoChainPipeline->result(0, fanOut));
+    EXPECT_TRUE(m_pAutoChainPipeline->result(1, joined));
+    EXPECT_EQ(240, fanOut);
+    EXPECT_EQ(241, joined);
+    for (const auto &pBranch : branches) {
+        EXPECT_EQ(CoreAsync::TA_BasicPipeline::State::Ready, pBranch->state());
+    }
+}
+
+TEST_F(TA_PipelineTest, nestedPipeline_holderTest) {
+    auto pChild = CoreAsync::ITA_PipelineCreator::createAutoChainPipeline();
+    auto activity_1 = CoreAsync::TA_ActivityCreator::create(&delayedStage, 4);
+    auto activity_2 = CoreAsync::TA_ActivityCreator::create(&MetaTest::sub, m_pTest, 10, 3);
+    pChild->add(activity_1, activity_2);
+
+    auto source = CoreAsync::TA_ActivityCreator::create(&MetaTest::sub, m_pTest, 1, 2);
+    m_pDagPipeline->add(source, pChild);
+    m_pDagPipeline->setPredecessors(1, {0});
+    for (int round = 0; round < 2; ++round) {
+        m_pDagPipeline->execute(CoreAsync::TA_BasicPipeline::ExecuteType::Sync)();
+        int res{0};
+        EXPECT_TRUE(m_pDagPipeline->result(1, res));
+        EXPECT_EQ(7, res);
+        m_pDagPipeline->reset();
+    }
+    EXPECT_EQ(CoreAsync::TA_BasicPipeline::State::Ready, pChild->state());
+    EXPECT_TRUE(CoreAsync::ITA_PipelineCreator::release(pChild));
+}
+
+TEST_F(TA_PipelineTest, nestedPipeline_manualTest) {
+    // Manual pipelines wait for a nested stage on their pipeline thread instead of storing the unstarted stage.
+    auto pChild{std::make_shared<CoreAsync::TA_AutoChainPipeline>()};
+    auto delayed = CoreAsync::TA_ActivityCreator::create(&delayedStage, 6);
+    auto child = CoreAsync::TA_ActivityCreator::create(&MetaTest::sub, m_pTest, 10, 3);
+    pChild->add(delayed, child);
+
+    auto source = CoreAsync::TA_ActivityCreator::create(&delayedStage, 2);
+    auto pNested{pChild.get()};
+    m_pManualChainPipeline->add(source, pNested);
+    int res{0};
+    m_pManualChainPipeline->execute()();
+    EXPECT_TRUE(m_pManualChainPipeline->result(0, res));
+    EXPECT_EQ(2, res);
+    m_pManualChainPipeline->execute()();
+    EXPECT_TRUE(m_pManualChainPipeline->result(1, res));
+    EXPECT_EQ(7, res);
+    EXPECT_EQ(CoreAsync::TA_BasicPipeline::State::Ready, pChild->state());
+
+    auto pSteps{m_pManualStepsChainPipeline.get()};
+    auto first = CoreAsync::TA_ActivityCreator::create(&MetaTest::sub, m_pTest, 4, 1);
+    pSteps->add(first, pNested);
+    pSteps->setSteps(2);
+    pSteps->execute()();
+    EXPECT_TRUE(pSteps->result(1, res));
+    EXPECT_EQ(7, res);
+}
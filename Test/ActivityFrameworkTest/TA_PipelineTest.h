@@ -26,6 +26,7 @@ class TA_ManualChainPipeline;
 class TA_ManualKeyActivityChainPipeline;
 class TA_ManualStepsChainPipeline;
 class TA_ConcurrentPipeline;
+class TA_DagPipeline;
 } // namespace CoreAsync
 
 class TA_PipelineTest : public ::testing ::Test {
@@ -42,6 +43,7 @@ class TA_PipelineTest : public ::testing ::Test {
     std::shared_ptr<CoreAsync::TA_ManualKeyActivityChainPipeline> m_pManualKeyActivityChainPipeline{nullptr};
     std::shared_ptr<CoreAsync::TA_ManualStepsChainPipeline> m_pManualStepsChainPipeline{nullptr};
     std::shared_ptr<CoreAsync::TA_ConcurrentPipeline> m_pConcurrentPipeline{nullptr};
+    std::shared_ptr<CoreAsync::TA_DagPipeline> m_pDagPipeline{nullptr};
 };
 
 #endif // TA_PIPELINETEST_H
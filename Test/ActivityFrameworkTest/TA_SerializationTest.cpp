@@ -113,6 +113,65 @@ TEST_F(TA_SerializationTest, VersionTest) {
     delete ptr;
 }
 
+TEST_F(TA_SerializationTest, MemoryBufferTest) {
+    float *ptr = new float(5.3);
+    M3Test t, p1;
+    std::vector<char> buffer;
+    {
+        CoreAsync::TA_Serializer<CoreAsync::MemoryBufferWriter> output(buffer);
+        t.setVec({2, 3, 4, 5});
+        t.setRawPtr(ptr);
+        t.setDeque({8, 7, 6, 5, 4});
+        t.m_vec = {1, 1, 1, 1};
+        output << t << std::uint64_t{42};
+    }
+    std::uint64_t tail{0};
+    {
+        CoreAsync::TA_Serializer<CoreAsync::MemoryBufferReader> input{std::span<const char>(buffer)};
+        input >> p1 >> tail;
+    }
+    EXPECT_EQ(t.getVec(), p1.getVec());
+    EXPECT_EQ(*t.getRawPtr(), *p1.getRawPtr());
+    EXPECT_EQ(t.getDeque(), p1.getDeque());
+    EXPECT_EQ(t.m_vec, p1.m_vec);
+    EXPECT_EQ(tail, 42);
+
+    delete ptr;
+}
+
+TEST_F(TA_SerializationTest, MemoryBufferCorruptTest) {
+    std::vector<char> buffer;
+    {
+        CoreAsync::TA_Serializer<CoreAsync::MemoryBufferWriter> output(buffer);
+        output << std::vector<int>{1, 2, 3};
+    }
+    {
+        CoreAsync::TA_Serializer<CoreAsync::MemoryBufferReader> input{std::span<const char>(buffer)};
+        std::vector<int> values;
+        input >> values;
+        EXPECT_FALSE(input.failed());
+        EXPECT_EQ(input.remaining(), 0);
+        EXPECT_EQ(values, std::vector<int>({1, 2, 3}));
+    }
+    {
+        // Reading past the end fails instead of reading garbage.
+        CoreAsync::TA_Serializer<CoreAsync::MemoryBufferReader> input{std::span<const char>(buffer)};
+        std::vector<int> values;
+        std::uint32_t tail{0};
+        input >> values >> tail;
+        EXPECT_TRUE(input.failed());
+    }
+    // The size follows the version, a corrupt one must not allocate what the data can't hold.
+    std::fill(buffer.begin() + sizeof(std::size_t), buffer.begin() + 2 * sizeof(std::size_t), char{0x7f});
+    {
+        CoreAsync::TA_Serializer<CoreAsync::MemoryBufferReader> input{std::span<const char>(buffer)};
+        std::vector<int> values;
+        input >> values;
+        EXPECT_TRUE(input.failed());
+        EXPECT_TRUE(values.empty());
+    }
+}
+
 // TEST_F(TA_SerializationTest, LargeScaleTest)
 // {
 //     CoreAsync::TA_Serializer output("./test.afw", 2, 10);
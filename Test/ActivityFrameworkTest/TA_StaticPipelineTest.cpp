@@ -0,0 +1,73 @@
+/*
+ * Copyright [2025] [Shuang Zhu / Sol]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TA_StaticPipelineTest.h"
+#include "Components/TA_StaticPipeline.h"
+
+#include <memory>
+#include <string>
+
+TA_StaticPipelineTest::TA_StaticPipelineTest() {}
+
+TA_StaticPipelineTest::~TA_StaticPipelineTest() {}
+
+void TA_StaticPipelineTest::SetUp() {}
+
+void TA_StaticPipelineTest::TearDown() {}
+
+TEST_F(TA_StaticPipelineTest, runTest) {
+    CoreAsync::TA_StaticPipeline pipeline{[](int a, int b) { return a + b; },
+                                          [](int sum) { return std::to_string(sum); },
+                                          [](const std::string &text) { return text + "!"; }};
+    static_assert(decltype(pipeline)::stageSize == 3);
+    static_assert(decltype(pipeline)::isChainable<int, int>);
+    static_assert(!decltype(pipeline)::isChainable<std::string>);
+    static_assert(decltype(pipeline)::brokenStage<std::string> == 0);
+    EXPECT_EQ(pipeline.run(1, 2), "3!");
+    EXPECT_EQ(pipeline(20, 22), "42!");
+}
+
+TEST_F(TA_StaticPipelineTest, brokenChainTest) {
+    auto first = [](int value) { return std::to_string(value); };
+    auto second = [](int value) { return value * 2; };
+    using Pipeline = CoreAsync::TA_StaticPipeline<decltype(first), decltype(second)>;
+    static_assert(!Pipeline::isChainable<int>);
+    static_assert(Pipeline::brokenStage<int> == 1);
+}
+
+TEST_F(TA_StaticPipelineTest, moveOnlyTest) {
+    int touched{0};
+    CoreAsync::TA_StaticPipeline pipeline{[](int value) { return std::make_unique<int>(value); },
+                                          [](std::unique_ptr<int> pValue) {
+                                              *pValue *= 3;
+                                              return pValue;
+                                          },
+                                          [&touched](std::unique_ptr<int> pValue) { touched = *pValue; },
+                                          [&touched]() { return touched + 1; }};
+    EXPECT_EQ(pipeline.run(5), 16);
+    EXPECT_EQ(touched, 15);
+}
+
+TEST_F(TA_StaticPipelineTest, activityTest) {
+    CoreAsync::TA_StaticPipeline pipeline{[](int value) { return value * 2; }, [](int value) { return value + 1; }};
+    auto fetcher = pipeline.post(20);
+    EXPECT_EQ(fetcher().get<int>(), 41);
+
+    auto activity = pipeline.createActivity(4);
+    decltype(auto) var = (*activity)();
+    EXPECT_EQ(9, var);
+    delete activity;
+}
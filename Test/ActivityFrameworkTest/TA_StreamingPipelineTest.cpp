@@ -0,0 +1,113 @@
+/*
+ * Copyright [2025] [Shuang Zhu / Sol]
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TA_StreamingPipelineTest.h"
+#include "Components/TA_StreamingPipeline.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using StageMode = CoreAsync::TA_StreamingPipeline::StageMode;
+
+TA_StreamingPipelineTest::TA_StreamingPipelineTest() {}
+
+TA_StreamingPipelineTest::~TA_StreamingPipelineTest() {}
+
+void TA_StreamingPipelineTest::SetUp() {}
+
+void TA_StreamingPipelineTest::TearDown() {}
+
+TEST_F(TA_StreamingPipelineTest, inOrderTest) {
+    CoreAsync::TA_StreamingPipeline pipeline{8};
+    std::vector<int> output;
+    pipeline.addStage(StageMode::Parallel, [](CoreAsync::TA_DefaultVariant var) {
+        int value{var.get<int>()};
+        std::this_thread::sleep_for(std::chrono::microseconds((value * 7) % 5 * 100));
+        return CoreAsync::TA_DefaultVariant{value * 2};
+    });
+    pipeline.addStage(StageMode::SerialInOrder, [&output](CoreAsync::TA_DefaultVariant var) {
+        output.emplace_back(var.get<int>());
+        return var;
+    });
+    for (int i = 0; i < 500; ++i) {
+        EXPECT_TRUE(pipeline.push(CoreAsync::TA_DefaultVariant{i}));
+    }
+    pipeline.wait();
+    ASSERT_EQ(output.size(), 500);
+    for (int i = 0; i < 500; ++i) {
+        EXPECT_EQ(output[i], i * 2);
+    }
+    EXPECT_EQ(pipeline.statistics(0).processed, 500);
+    EXPECT_EQ(pipeline.statistics(1).processed, 500);
+    EXPECT_GT(pipeline.statistics(1).throughput, 0.0);
+    EXPECT_FALSE(pipeline.addStage(StageMode::Parallel, [](CoreAsync::TA_DefaultVariant var) { return var; }));
+}
+
+TEST_F(TA_StreamingPipelineTest, tokenLimitTest) {
+    CoreAsync::TA_StreamingPipeline pipeline{3};
+    std::atomic_int running{0}, peak{0}, serialRunning{0};
+    std::atomic_bool overlapped{false};
+    std::atomic_int sum{0};
+    pipeline.addStage(StageMode::Parallel, [&](CoreAsync::TA_DefaultVariant var) {
+        int now{running.fetch_add(1) + 1};
+        int prev{peak.load()};
+        while (prev < now && !peak.compare_exchange_weak(prev, now)) {
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+        running.fetch_sub(1);
+        return var;
+    });
+    pipeline.addStage(StageMode::SerialOutOfOrder, [&](CoreAsync::TA_DefaultVariant var) {
+        if (serialRunning.fetch_add(1) != 0) {
+            overlapped = true;
+        }
+        sum += var.get<int>();
+        serialRunning.fetch_sub(1);
+        return var;
+    });
+    for (int i = 1; i <= 200; ++i) {
+        pipeline.push(CoreAsync::TA_DefaultVariant{i});
+        EXPECT_LE(pipeline.inFlight(), 3);
+    }
+    pipeline.wait();
+    EXPECT_EQ(sum.load(), 20100);
+    EXPECT_LE(peak.load(), 3);
+    EXPECT_FALSE(overlapped.load());
+    EXPECT_EQ(pipeline.inFlight(), 0);
+}
+
+TEST_F(TA_StreamingPipelineTest, exceptionTest) {
+    CoreAsync::TA_StreamingPipeline pipeline{4};
+    std::vector<int> output;
+    pipeline.addStage(StageMode::Parallel, [](CoreAsync::TA_DefaultVariant var) {
+        if (var.get<int>() == 3) {
+            throw std::runtime_error("stage failed");
+        }
+        return var;
+    });
+    pipeline.addStage(StageMode::SerialInOrder, [&output](CoreAsync::TA_DefaultVariant var) {
+        output.emplace_back(var.get<int>());
+        return var;
+    });
+    for (int i = 0; i < 10; ++i) {
+        pipeline.push(CoreAsync::TA_DefaultVariant{i});
+    }
+    EXPECT_THROW(pipeline.wait(), std::runtime_error);
+    EXPECT_EQ(output, (std::vector<int>{0, 1, 2, 4, 5, 6, 7, 8, 9}));
+    EXPECT_NO_THROW(pipeline.wait());
+}